@@ -0,0 +1,556 @@
+/*!
+ * @file qcrcbench.c
+ * @author J. Camilo Gomez C.
+ * @note This file is part of the qTools distribution.
+ * @brief Throughput and correctness benchmark for qCRC. Every code path of
+ * qcrc.c ( one-shot qCRCx(), table, slicing-by-8/16, hardware-accelerated,
+ * batch, multi-threaded and generic-width ) is first cross-checked against
+ * the check values of a CRC catalogue and against the bit-at-a-time qCRCn()
+ * reference on random data, then timed in
+ * GB/s and cycles/byte for message sizes from 8 B to 64 MB, with hot and
+ * cold caches. The process exits with a non-zero status if any result is
+ * wrong, so it can be used as a gate for performance work on qCRC.
+ *
+ * Build ( POSIX ):
+ *   cc -std=c99 -O2 -Iinclude bench/qcrcbench.c qcrc.c qcrcpar.c -lpthread -o qcrcbench
+ *
+ * Usage:
+ *   qcrcbench [-c] [-m maxsize] [-a arenaMB] [-f GHz] [-t threads]
+ *     -c  Only run the correctness checks.
+ *     -m  Largest message size in bytes ( default 67108864 ).
+ *     -a  Size of the cold-cache arena in MB, should exceed the last level
+ *         cache ( default 256 ).
+ *     -f  Core frequency used to convert time to cycles when no cycle
+ *         counter is available ( default: x86 TSC or not reported ).
+ *     -t  Threads for the multi-threaded path ( default: online cpus ).
+ **/
+
+#ifndef _POSIX_C_SOURCE
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "qcrc.h"
+#include "qcrcpar.h"
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+    #include <x86intrin.h>
+    #define QCRCBENCH_TSC
+#endif
+
+#define QCRCBENCH_MIN_SIZE          ( 8u )
+#define QCRCBENCH_MAX_SIZE          ( 67108864u )
+#define QCRCBENCH_MIN_TIME          ( 0.05 )
+#define QCRCBENCH_BATCH_N           ( 16u )
+#define QCRCBENCH_BATCH_MAX_SIZE    ( 65536u )
+#define QCRCBENCH_RANDOM_SIZE       ( 1048576u + 13u )
+
+typedef struct {
+    const char *name;
+    uint8_t width;
+    uint64_t poly, init;
+    uint8_t refIn, refOut;
+    uint64_t xorOut, check;
+} qCRCBench_Param_t;
+
+typedef enum {
+    QCRCBENCH_REFERENCE = 0,
+    QCRCBENCH_ONESHOT,
+    QCRCBENCH_TABLE,
+    QCRCBENCH_SLICE8,
+    QCRCBENCH_SLICE16,
+    QCRCBENCH_HW,
+    QCRCBENCH_HW_CRC32C,
+    QCRCBENCH_STREAM,
+    QCRCBENCH_BATCH,
+    QCRCBENCH_PARALLEL,
+    QCRCBENCH_GENERIC,
+    QCRCBENCH_NPATHS
+} qCRCBench_Path_t;
+
+/*check values of the string "123456789"*/
+static const qCRCBench_Param_t catalogue[] = {
+    { "CRC-8/SMBUS",        8u, 0x07u, 0x00u, 0u, 0u, 0x00u, 0xF4u },
+    { "CRC-8/MAXIM-DOW",    8u, 0x31u, 0x00u, 1u, 1u, 0x00u, 0xA1u },
+    { "CRC-8/ROHC",         8u, 0x07u, 0xFFu, 1u, 1u, 0x00u, 0xD0u },
+    { "CRC-8/CDMA2000",     8u, 0x9Bu, 0xFFu, 0u, 0u, 0x00u, 0xDAu },
+    { "CRC-8/DVB-S2",       8u, 0xD5u, 0x00u, 0u, 0u, 0x00u, 0xBCu },
+    { "CRC-8/I-432-1",      8u, 0x07u, 0x00u, 0u, 0u, 0x55u, 0xA1u },
+    { "CRC-16/IBM-3740",    16u, 0x1021u, 0xFFFFu, 0u, 0u, 0x0000u, 0x29B1u },
+    { "CRC-16/ARC",         16u, 0x8005u, 0x0000u, 1u, 1u, 0x0000u, 0xBB3Du },
+    { "CRC-16/MODBUS",      16u, 0x8005u, 0xFFFFu, 1u, 1u, 0x0000u, 0x4B37u },
+    { "CRC-16/KERMIT",      16u, 0x1021u, 0x0000u, 1u, 1u, 0x0000u, 0x2189u },
+    { "CRC-16/XMODEM",      16u, 0x1021u, 0x0000u, 0u, 0u, 0x0000u, 0x31C3u },
+    { "CRC-16/IBM-SDLC",    16u, 0x1021u, 0xFFFFu, 1u, 1u, 0xFFFFu, 0x906Eu },
+    { "CRC-16/USB",         16u, 0x8005u, 0xFFFFu, 1u, 1u, 0xFFFFu, 0xB4C8u },
+    { "CRC-16/GENIBUS",     16u, 0x1021u, 0xFFFFu, 0u, 0u, 0xFFFFu, 0xD64Eu },
+    { "CRC-32/ISO-HDLC",    32u, 0x04C11DB7u, 0xFFFFFFFFu, 1u, 1u, 0xFFFFFFFFu, 0xCBF43926u },
+    { "CRC-32/BZIP2",       32u, 0x04C11DB7u, 0xFFFFFFFFu, 0u, 0u, 0xFFFFFFFFu, 0xFC891918u },
+    { "CRC-32/ISCSI",       32u, 0x1EDC6F41u, 0xFFFFFFFFu, 1u, 1u, 0xFFFFFFFFu, 0xE3069283u },
+    { "CRC-32/MPEG-2",      32u, 0x04C11DB7u, 0xFFFFFFFFu, 0u, 0u, 0x00000000u, 0x0376E6E7u },
+    { "CRC-32/CKSUM",       32u, 0x04C11DB7u, 0x00000000u, 0u, 0u, 0xFFFFFFFFu, 0x765E7680u },
+    { "CRC-32/JAMCRC",      32u, 0x04C11DB7u, 0xFFFFFFFFu, 1u, 1u, 0x00000000u, 0x340BC6D9u },
+    { "CRC-32/XFER",        32u, 0x000000AFu, 0x00000000u, 0u, 0u, 0x00000000u, 0xBD0BE338u },
+    { "CRC-32/AIXM",        32u, 0x814141ABu, 0x00000000u, 0u, 0u, 0x00000000u, 0x3010BF7Fu },
+    { "CRC-32/BASE91-D",    32u, 0xA833982Bu, 0xFFFFFFFFu, 1u, 1u, 0xFFFFFFFFu, 0x87315576u },
+    { "CRC-32/AUTOSAR",     32u, 0xF4ACFB13u, 0xFFFFFFFFu, 1u, 1u, 0xFFFFFFFFu, 0x1697D06Au },
+    { "CRC-3/GSM",          3u, 0x3u, 0x0u, 0u, 0u, 0x7u, 0x4u },
+    { "CRC-3/ROHC",         3u, 0x3u, 0x7u, 1u, 1u, 0x0u, 0x6u },
+    { "CRC-4/G-704",        4u, 0x3u, 0x0u, 1u, 1u, 0x0u, 0x7u },
+    { "CRC-5/USB",          5u, 0x05u, 0x1Fu, 1u, 1u, 0x1Fu, 0x19u },
+    { "CRC-6/CDMA2000-A",   6u, 0x27u, 0x3Fu, 0u, 0u, 0x00u, 0x0Du },
+    { "CRC-7/MMC",          7u, 0x09u, 0x00u, 0u, 0u, 0x00u, 0x75u },
+    { "CRC-10/ATM",         10u, 0x233u, 0x000u, 0u, 0u, 0x000u, 0x199u },
+    { "CRC-11/FLEXRAY",     11u, 0x385u, 0x01Au, 0u, 0u, 0x000u, 0x5A3u },
+    { "CRC-12/UMTS",        12u, 0x80Fu, 0x000u, 0u, 1u, 0x000u, 0xDAFu },
+    { "CRC-15/CAN",         15u, 0x4599u, 0x0000u, 0u, 0u, 0x0000u, 0x059Eu },
+    { "CRC-21/CAN-FD",      21u, 0x102899u, 0x000000u, 0u, 0u, 0x000000u, 0x0ED841u },
+    { "CRC-24/OPENPGP",     24u, 0x864CFBu, 0xB704CEu, 0u, 0u, 0x000000u, 0x21CF02u },
+    { "CRC-24/BLE",         24u, 0x00065Bu, 0x555555u, 1u, 1u, 0x000000u, 0xC25A56u },
+    { "CRC-40/GSM",         40u, 0x0004820009uLL, 0x0uLL, 0u, 0u, 0xFFFFFFFFFFuLL, 0xD4164FC646uLL },
+    { "CRC-64/ECMA-182",    64u, 0x42F0E1EBA9EA3693uLL, 0x0uLL, 0u, 0u, 0x0uLL, 0x6C40DF5F0B497347uLL },
+    { "CRC-64/GO-ISO",      64u, 0x000000000000001BuLL, 0xFFFFFFFFFFFFFFFFuLL, 1u, 1u, 0xFFFFFFFFFFFFFFFFuLL, 0xB90956C775A41001uLL },
+    { "CRC-64/WE",          64u, 0x42F0E1EBA9EA3693uLL, 0xFFFFFFFFFFFFFFFFuLL, 0u, 0u, 0xFFFFFFFFFFFFFFFFuLL, 0x62EC59E3F1A4F00AuLL },
+    { "CRC-64/XZ",          64u, 0x42F0E1EBA9EA3693uLL, 0xFFFFFFFFFFFFFFFFuLL, 1u, 1u, 0xFFFFFFFFFFFFFFFFuLL, 0x995DC9BBDF1939FAuLL },
+};
+
+static const char * const pathNames[ QCRCBENCH_NPATHS ] = {
+    "qCRCn-bit", "qCRCx", "table", "slice8", "slice16", "hw", "hw-crc32c",
+    "stream", "batch", "parallel", "generic"
+};
+
+static qCRC_Engine_t engine;
+static qCRC_Engine_t engineC;
+static qCRCn_Engine_t engineN;
+static uint32_t sliceArea[ QCRC_SLICING_SIZE( 16u ) ];
+static const size_t benchSizes[] = {
+    8u, 64u, 512u, 4096u, 32768u, 262144u, 1048576u, 4194304u, 16777216u, 67108864u
+};
+static const qCRCBench_Param_t * const benchParam = &catalogue[ 14 ];
+static size_t nThreads = 0u;
+static double ghz = 0.0;
+static volatile uint64_t sink;
+
+static int qCRCBench_Check( void );
+static int qCRCBench_CheckParam( const qCRCBench_Param_t * const p,
+                                 const uint8_t * const data,
+                                 const size_t length,
+                                 const uint64_t expected );
+static uint64_t qCRCBench_Run( const qCRCBench_Path_t path,
+                               const uint8_t * const data,
+                               const size_t length );
+static int qCRCBench_Select( const qCRCBench_Path_t path );
+static void qCRCBench_Measure( const qCRCBench_Path_t path,
+                               uint8_t * const arena,
+                               const size_t arenaSize,
+                               const size_t size,
+                               const int cold );
+static double qCRCBench_Now( void );
+static uint64_t qCRCBench_Cycles( void );
+static uint64_t qCRCBench_Random( void );
+
+/*============================================================================*/
+static double qCRCBench_Now( void )
+{
+    struct timespec ts;
+
+    (void)clock_gettime( CLOCK_MONOTONIC, &ts );
+
+    return (double)ts.tv_sec + ( 1.0e-9*(double)ts.tv_nsec );
+}
+/*============================================================================*/
+static uint64_t qCRCBench_Cycles( void )
+{
+    #if defined( QCRCBENCH_TSC )
+        /*the TSC counts at the nominal frequency, close to core cycles when
+        frequency scaling is disabled*/
+        return (uint64_t)__rdtsc();
+    #else
+        return 0u;
+    #endif
+}
+/*============================================================================*/
+static uint64_t qCRCBench_Random( void )
+{
+    static uint64_t x = 0x9E3779B97F4A7C15uLL;
+
+    x ^= x << 13u;
+    x ^= x >> 7u;
+    x ^= x << 17u;
+
+    return x;
+}
+/*============================================================================*/
+static int qCRCBench_Select( const qCRCBench_Path_t path )
+{
+    int retValue = 1;
+    const qCRCBench_Param_t * const p = benchParam;
+
+    (void)qCRCx_Setup( &engine, QCRC32, (uint32_t)p->poly, (uint32_t)p->init,
+                       p->refIn, p->refOut, (uint32_t)p->xorOut );
+    switch ( path ) {
+        case QCRCBENCH_TABLE:
+        case QCRCBENCH_BATCH:
+            (void)qCRCx_SetAccel( &engine, 0u );
+            break;
+        case QCRCBENCH_SLICE8:
+        case QCRCBENCH_SLICE16:
+            (void)qCRCx_SetAccel( &engine, 0u );
+            retValue = qCRCx_SetSlicing( &engine, sliceArea,
+                                         ( QCRCBENCH_SLICE8 == path )? 8u : 16u );
+            break;
+        case QCRCBENCH_HW:
+            retValue = qCRCx_SetAccel( &engine, 1u );
+            break;
+        case QCRCBENCH_HW_CRC32C:
+            retValue = qCRCx_Setup( &engineC, QCRC32, 0x1EDC6F41u, 0xFFFFFFFFu,
+                                    1u, 1u, 0xFFFFFFFFu ) &&
+                       qCRCx_SetAccel( &engineC, 1u );
+            break;
+        case QCRCBENCH_GENERIC:
+            retValue = qCRCn_Setup( &engineN, p->width, p->poly, p->init,
+                                    p->refIn, p->refOut, p->xorOut );
+            break;
+        default:
+            /*best available path*/
+            break;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static uint64_t qCRCBench_Run( const qCRCBench_Path_t path,
+                               const uint8_t * const data,
+                               const size_t length )
+{
+    uint64_t crc = 0u;
+    const qCRCBench_Param_t * const p = benchParam;
+
+    switch ( path ) {
+        case QCRCBENCH_REFERENCE:
+            crc = qCRCn( p->width, data, length, p->poly, p->init,
+                         p->refIn, p->refOut, p->xorOut );
+            break;
+        case QCRCBENCH_ONESHOT:
+            crc = qCRCx( QCRC32, data, length, (uint32_t)p->poly,
+                         (uint32_t)p->init, p->refIn, p->refOut,
+                         (uint32_t)p->xorOut );
+            break;
+        case QCRCBENCH_HW_CRC32C:
+            crc = qCRCx_Compute( &engineC, data, length );
+            break;
+        case QCRCBENCH_STREAM: {
+            qCRC_State_t s;
+            size_t i, n;
+            /*feed the data in chunks of odd sizes*/
+            (void)qCRCx_Init( &s, &engine );
+            for ( i = 0u ; i < length ; i += n ) {
+                n = ( ( length - i ) < 4093u )? ( length - i ) : 4093u;
+                (void)qCRCx_Update( &s, &data[ i ], n );
+            }
+            crc = qCRCx_Final( &s );
+            break;
+        }
+        case QCRCBENCH_BATCH: {
+            /*QCRCBENCH_BATCH_N independent messages of length bytes each*/
+            const void *bufs[ QCRCBENCH_BATCH_N ];
+            size_t lens[ QCRCBENCH_BATCH_N ];
+            uint32_t out[ QCRCBENCH_BATCH_N ];
+            size_t i;
+
+            for ( i = 0u ; i < QCRCBENCH_BATCH_N ; ++i ) {
+                bufs[ i ] = &data[ i*length ];
+                lens[ i ] = length;
+            }
+            (void)qCRCx_Batch( &engine, bufs, lens, out, QCRCBENCH_BATCH_N );
+            for ( i = 0u ; i < QCRCBENCH_BATCH_N ; ++i ) {
+                crc ^= out[ i ];
+            }
+            break;
+        }
+        case QCRCBENCH_PARALLEL:
+            crc = qCRCx_Parallel( &engine, data, length, nThreads );
+            break;
+        case QCRCBENCH_GENERIC:
+            crc = qCRCn_Compute( &engineN, data, length );
+            break;
+        default:
+            crc = qCRCx_Compute( &engine, data, length );
+            break;
+    }
+
+    return crc;
+}
+/*============================================================================*/
+static int qCRCBench_CheckParam( const qCRCBench_Param_t * const p,
+                                 const uint8_t * const data,
+                                 const size_t length,
+                                 const uint64_t expected )
+{
+    int fails = 0;
+    uint64_t got[ QCRCBENCH_NPATHS ];
+    int used[ QCRCBENCH_NPATHS ] = { 0 };
+    qCRCn_Engine_t en;
+    qCRCn_State_t sn;
+    size_t i;
+
+    got[ QCRCBENCH_REFERENCE ] = qCRCn( p->width, data, length, p->poly, p->init,
+                                        p->refIn, p->refOut, p->xorOut );
+    used[ QCRCBENCH_REFERENCE ] = 1;
+    (void)qCRCn_Setup( &en, p->width, p->poly, p->init, p->refIn, p->refOut, p->xorOut );
+    got[ QCRCBENCH_GENERIC ] = qCRCn_Compute( &en, data, length );
+    used[ QCRCBENCH_GENERIC ] = 1;
+    (void)qCRCn_Init( &sn, &en );
+    (void)qCRCn_Update( &sn, data, length/2u );
+    (void)qCRCn_Update( &sn, &data[ length/2u ], length - ( length/2u ) );
+    got[ QCRCBENCH_STREAM ] = qCRCn_Final( &sn );
+    used[ QCRCBENCH_STREAM ] = 1;
+
+    if ( ( 8u == p->width ) || ( 16u == p->width ) || ( 32u == p->width ) ) {
+        const qCRC_Mode_t mode = ( 8u == p->width )? QCRC8 :
+                                 ( ( 16u == p->width )? QCRC16 : QCRC32 );
+        qCRC_Engine_t e;
+        qCRC_State_t s;
+        const void *bufs[ 3 ];
+        size_t lens[ 3 ];
+        uint32_t out[ 3 ], c;
+
+        got[ QCRCBENCH_ONESHOT ] = qCRCx( mode, data, length, (uint32_t)p->poly,
+                                          (uint32_t)p->init, p->refIn, p->refOut,
+                                          (uint32_t)p->xorOut );
+        used[ QCRCBENCH_ONESHOT ] = 1;
+        (void)qCRCx_Setup( &e, mode, (uint32_t)p->poly, (uint32_t)p->init,
+                           p->refIn, p->refOut, (uint32_t)p->xorOut );
+        (void)qCRCx_SetAccel( &e, 0u );
+        got[ QCRCBENCH_TABLE ] = qCRCx_Compute( &e, data, length );
+        used[ QCRCBENCH_TABLE ] = 1;
+        /*the streaming and combined results must match as well*/
+        (void)qCRCx_Init( &s, &e );
+        (void)qCRCx_Update( &s, data, length/3u );
+        (void)qCRCx_Update( &s, &data[ length/3u ], length - ( length/3u ) );
+        c = qCRCx_Final( &s );
+        if ( c != got[ QCRCBENCH_TABLE ] ) {
+            ++fails;
+            (void)printf( "FAIL %-18s stream\n", p->name );
+        }
+        c = qCRCx_Combine( qCRCx_Compute( &e, data, length/3u ),
+                           qCRCx_Compute( &e, &data[ length/3u ], length - ( length/3u ) ),
+                           length - ( length/3u ), &e );
+        if ( ( length > 3u ) && ( c != got[ QCRCBENCH_TABLE ] ) ) {
+            ++fails;
+            (void)printf( "FAIL %-18s combine\n", p->name );
+        }
+        for ( i = 0u ; i < 3u ; ++i ) {
+            bufs[ i ] = data;
+            lens[ i ] = length;
+        }
+        (void)qCRCx_Batch( &e, bufs, lens, out, 3u );
+        got[ QCRCBENCH_BATCH ] = out[ 2 ];
+        used[ QCRCBENCH_BATCH ] = ( out[ 0 ] == out[ 1 ] ) && ( out[ 1 ] == out[ 2 ] )? 1 : 2;
+        if ( QCRC32 == mode ) {
+            (void)qCRCx_SetSlicing( &e, sliceArea, 8u );
+            got[ QCRCBENCH_SLICE8 ] = qCRCx_Compute( &e, data, length );
+            used[ QCRCBENCH_SLICE8 ] = 1;
+            (void)qCRCx_SetSlicing( &e, sliceArea, 16u );
+            got[ QCRCBENCH_SLICE16 ] = qCRCx_Compute( &e, data, length );
+            used[ QCRCBENCH_SLICE16 ] = 1;
+            if ( 0 != qCRCx_SetAccel( &e, 1u ) ) {
+                got[ QCRCBENCH_HW ] = qCRCx_Compute( &e, data, length );
+                used[ QCRCBENCH_HW ] = 1;
+            }
+            got[ QCRCBENCH_PARALLEL ] = qCRCx_Parallel( &e, data, length, nThreads );
+            used[ QCRCBENCH_PARALLEL ] = 1;
+        }
+    }
+
+    for ( i = 0u ; i < (size_t)QCRCBENCH_NPATHS ; ++i ) {
+        if ( ( 0 != used[ i ] ) && ( ( 2 == used[ i ] ) || ( got[ i ] != expected ) ) ) {
+            ++fails;
+            (void)printf( "FAIL %-18s %-10s got 0x%llX expected 0x%llX\n",
+                          p->name, pathNames[ i ],
+                          (unsigned long long)got[ i ],
+                          (unsigned long long)expected );
+        }
+    }
+
+    return fails;
+}
+/*============================================================================*/
+static int qCRCBench_Check( void )
+{
+    int fails = 0;
+    size_t i;
+    const size_t n = sizeof(catalogue)/sizeof(catalogue[ 0 ]);
+    uint8_t *rnd = malloc( QCRCBENCH_RANDOM_SIZE );
+
+    if ( NULL == rnd ) {
+        (void)printf( "FAIL out of memory\n" );
+        return 1;
+    }
+    for ( i = 0u ; i < QCRCBENCH_RANDOM_SIZE ; ++i ) {
+        rnd[ i ] = (uint8_t)qCRCBench_Random();
+    }
+    for ( i = 0u ; i < n ; ++i ) {
+        const qCRCBench_Param_t * const p = &catalogue[ i ];
+        /*catalogue check value, then random data against the qCRCn()
+        reference, long enough to reach the slicing and hardware paths*/
+        fails += qCRCBench_CheckParam( p, (const uint8_t*)"123456789", 9u, p->check );
+        fails += qCRCBench_CheckParam( p, rnd, QCRCBENCH_RANDOM_SIZE,
+                                       qCRCn( p->width, rnd, QCRCBENCH_RANDOM_SIZE,
+                                              p->poly, p->init, p->refIn,
+                                              p->refOut, p->xorOut ) );
+    }
+    (void)printf( "correctness: %d parameter sets, %d failures\n", (int)n, fails );
+    free( rnd );
+
+    return fails;
+}
+/*============================================================================*/
+static void qCRCBench_Measure( const qCRCBench_Path_t path,
+                               uint8_t * const arena,
+                               const size_t arenaSize,
+                               const size_t size,
+                               const int cold )
+{
+    size_t reps = 0u, offset = 0u;
+    double t0, t;
+    uint64_t c0, c;
+    uint64_t acc = 0u;
+    const size_t span = ( QCRCBENCH_BATCH == path )? ( size*QCRCBENCH_BATCH_N ) : size;
+    /*cold runs walk the arena so each message is read from memory*/
+    const size_t stride = ( ( span + 4095u )/4096u )*4096u;
+
+    (void)qCRCBench_Run( path, arena, size );
+    t0 = qCRCBench_Now();
+    c0 = qCRCBench_Cycles();
+    do {
+        size_t k;
+        /*read the clock every 64 KB so it does not weigh on small sizes*/
+        for ( k = ( 65536u + span - 1u )/span ; k > 0u ; --k ) {
+            if ( 0 != cold ) {
+                offset += stride;
+                if ( ( offset + span ) > arenaSize ) {
+                    offset = 0u;
+                }
+            }
+            acc ^= qCRCBench_Run( path, &arena[ offset ], size );
+            ++reps;
+        }
+        t = qCRCBench_Now() - t0;
+    } while ( ( t < QCRCBENCH_MIN_TIME ) || ( reps < 3u ) );
+    c = qCRCBench_Cycles() - c0;
+    sink ^= acc;
+
+    {
+        const double bytes = (double)span*(double)reps;
+        const double gbps = bytes/t*1.0e-9;
+        double cpb = -1.0;
+
+        if ( 0u != c ) {
+            cpb = (double)c/bytes;
+        }
+        else if ( ghz > 0.0 ) {
+            cpb = ( t*ghz*1.0e9 )/bytes;
+        }
+        else {
+            /*no cycle counter*/
+        }
+        if ( cpb >= 0.0 ) {
+            (void)printf( " %8.3f %7.2f |", gbps, cpb );
+        }
+        else {
+            (void)printf( " %8.3f %7s |", gbps, "-" );
+        }
+    }
+}
+/*============================================================================*/
+int main( int argc, char *argv[] )
+{
+    size_t maxSize = QCRCBENCH_MAX_SIZE;
+    size_t arenaSize = 256u*1048576u;
+    int checkOnly = 0;
+    int fails, i;
+    uint8_t *arena;
+
+    for ( i = 1 ; i < argc ; ++i ) {
+        if ( 0 == strcmp( argv[ i ], "-c" ) ) {
+            checkOnly = 1;
+        }
+        else if ( ( 0 == strcmp( argv[ i ], "-m" ) ) && ( ( i + 1 ) < argc ) ) {
+            maxSize = (size_t)strtoull( argv[ ++i ], NULL, 0 );
+        }
+        else if ( ( 0 == strcmp( argv[ i ], "-a" ) ) && ( ( i + 1 ) < argc ) ) {
+            arenaSize = (size_t)strtoull( argv[ ++i ], NULL, 0 )*1048576u;
+        }
+        else if ( ( 0 == strcmp( argv[ i ], "-f" ) ) && ( ( i + 1 ) < argc ) ) {
+            ghz = strtod( argv[ ++i ], NULL );
+        }
+        else if ( ( 0 == strcmp( argv[ i ], "-t" ) ) && ( ( i + 1 ) < argc ) ) {
+            nThreads = (size_t)strtoull( argv[ ++i ], NULL, 0 );
+        }
+        else {
+            (void)fprintf( stderr, "usage: %s [-c] [-m maxsize] [-a arenaMB] [-f GHz] [-t threads]\n", argv[ 0 ] );
+            return 2;
+        }
+    }
+
+    fails = qCRCBench_Check();
+    if ( ( 0 != fails ) || ( 0 != checkOnly ) ) {
+        return ( 0 != fails )? 1 : 0;
+    }
+
+    if ( maxSize < QCRCBENCH_MIN_SIZE ) {
+        maxSize = QCRCBENCH_MIN_SIZE;
+    }
+    if ( arenaSize < ( 2u*maxSize ) ) {
+        arenaSize = 2u*maxSize;
+    }
+    if ( arenaSize < ( 2u*QCRCBENCH_BATCH_N*QCRCBENCH_BATCH_MAX_SIZE ) ) {
+        arenaSize = 2u*QCRCBENCH_BATCH_N*QCRCBENCH_BATCH_MAX_SIZE;
+    }
+    arena = malloc( arenaSize );
+    if ( NULL == arena ) {
+        (void)fprintf( stderr, "cannot allocate a %zu MB arena\n", arenaSize/1048576u );
+        return 2;
+    }
+    {
+        size_t k;
+        for ( k = 0u ; k < arenaSize ; ++k ) {
+            arena[ k ] = (uint8_t)qCRCBench_Random();
+        }
+    }
+
+    (void)printf( "\n%s, GB/s and cycles/byte%s\n", benchParam->name,
+                  ( ( 0u == qCRCBench_Cycles() ) && ( ghz <= 0.0 ) )? " (no cycle counter, use -f)" : "" );
+    for ( i = 0 ; i < (int)QCRCBENCH_NPATHS ; ++i ) {
+        const qCRCBench_Path_t path = (qCRCBench_Path_t)i;
+        size_t k;
+
+        if ( 0 == qCRCBench_Select( path ) ) {
+            (void)printf( "%-10s not available on this target\n", pathNames[ i ] );
+            continue;
+        }
+        (void)printf( "\n%-10s | %9s | %17s | %17s |\n", pathNames[ i ], "bytes",
+                      "hot  GB/s    cpb", "cold GB/s    cpb" );
+        for ( k = 0u ; k < ( sizeof(benchSizes)/sizeof(benchSizes[ 0 ]) ) ; ++k ) {
+            const size_t size = benchSizes[ k ];
+
+            if ( ( size > maxSize ) ||
+                 ( ( QCRCBENCH_BATCH == path ) && ( size > QCRCBENCH_BATCH_MAX_SIZE ) ) ) {
+                break;
+            }
+            (void)printf( "%-10s | %9lu |", "", (unsigned long)size );
+            qCRCBench_Measure( path, arena, arenaSize, size, 0 );
+            qCRCBench_Measure( path, arena, arenaSize, size, 1 );
+            (void)printf( "\n" );
+            (void)fflush( stdout );
+        }
+    }
+    free( arena );
+
+    return 0;
+}
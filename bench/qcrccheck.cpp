@@ -0,0 +1,100 @@
+/*!
+ * @file qcrccheck.cpp
+ * @author J. Camilo Gomez C.
+ * @note This file is part of the qTools distribution.
+ * @brief Cross-check of the qlibs::crc C++ front end against qCRCn() for the
+ * widths below 8 bits, where the non-reflected register runs left-aligned in
+ * a byte. Every width from 3 to 7 bits is checked with the four RefIn/RefOut
+ * combinations: the check values are verified at compile time and the
+ * results on random data at run time. The process exits with a non-zero
+ * status if any result differs.
+ *
+ * Build:
+ *   cc -std=c99 -O2 -Iinclude -c qcrc.c -o qcrc.o
+ *   c++ -std=c++14 -O2 -Iinclude bench/qcrccheck.cpp qcrc.o -o qcrccheck
+ **/
+
+#include <cstdio>
+#include <cstdint>
+#include <cstddef>
+#include "qcrc.hpp"
+
+#define QCRCCHECK_RANDOM_SIZE       ( 1021u )
+
+namespace {
+    std::uint8_t rnd[ QCRCCHECK_RANDOM_SIZE ];
+
+    /*the same arbitrary parameters for every width, masked to the width*/
+    constexpr std::uint64_t wmask( const unsigned Width )
+    {
+        return ( 1uLL << Width ) - 1u;
+    }
+
+    template <unsigned Width, bool RefIn, bool RefOut, std::uint64_t Check>
+    int checkWidth( void )
+    {
+        constexpr std::uint64_t poly = ( 0x5Bu & wmask( Width ) ) | 1u;
+        constexpr std::uint64_t init = 0x2Au & wmask( Width );
+        constexpr std::uint64_t xorOut = 0x11u & wmask( Width );
+        using crc = qlibs::crc<Width, poly, init, RefIn, RefOut, xorOut>;
+        /*check values of the string "123456789" as given by qCRCn()*/
+        static_assert( Check == crc::check(), "check value differs from qCRCn" );
+        int fails = 0;
+        std::size_t n;
+
+        /*every length, so the last byte of the message takes all values*/
+        for ( n = 1u ; n <= QCRCCHECK_RANDOM_SIZE ; ++n ) {
+            const std::uint64_t expected = qCRCn( static_cast<std::uint8_t>( Width ),
+                                                  rnd, n, poly, init,
+                                                  RefIn ? 1u : 0u, RefOut ? 1u : 0u,
+                                                  xorOut );
+            if ( expected != crc::compute( rnd, n ) ) {
+                ++fails;
+            }
+        }
+        if ( 0 != fails ) {
+            (void)std::printf( "FAIL width %u refin %d refout %d: %d lengths differ\n",
+                               Width, RefIn ? 1 : 0, RefOut ? 1 : 0, fails );
+        }
+
+        return fails;
+    }
+}
+
+int main( void )
+{
+    int fails = 0;
+    std::uint64_t x = 0x9E3779B97F4A7C15uLL;
+    std::size_t i;
+
+    for ( i = 0u ; i < QCRCCHECK_RANDOM_SIZE ; ++i ) {
+        x ^= x << 13u;
+        x ^= x >> 7u;
+        x ^= x << 17u;
+        rnd[ i ] = static_cast<std::uint8_t>( x );
+    }
+
+    fails += checkWidth<3u, false, false, 0x1u>();
+    fails += checkWidth<3u, false, true, 0x1u>();
+    fails += checkWidth<3u, true, false, 0x0u>();
+    fails += checkWidth<3u, true, true, 0x5u>();
+    fails += checkWidth<4u, false, false, 0x6u>();
+    fails += checkWidth<4u, false, true, 0xFu>();
+    fails += checkWidth<4u, true, false, 0xFu>();
+    fails += checkWidth<4u, true, true, 0x6u>();
+    fails += checkWidth<5u, false, false, 0x03u>();
+    fails += checkWidth<5u, false, true, 0x18u>();
+    fails += checkWidth<5u, true, false, 0x1Fu>();
+    fails += checkWidth<5u, true, true, 0x1Fu>();
+    fails += checkWidth<6u, false, false, 0x06u>();
+    fails += checkWidth<6u, false, true, 0x2Bu>();
+    fails += checkWidth<6u, true, false, 0x23u>();
+    fails += checkWidth<6u, true, true, 0x02u>();
+    fails += checkWidth<7u, false, false, 0x69u>();
+    fails += checkWidth<7u, false, true, 0x1Eu>();
+    fails += checkWidth<7u, true, false, 0x12u>();
+    fails += checkWidth<7u, true, true, 0x71u>();
+    (void)std::printf( "qlibs::crc vs qCRCn, widths 3 to 7: %d failures\n", fails );
+
+    return ( 0 != fails )? 1 : 0;
+}
@@ -22,10 +22,96 @@ extern "C" {
         QCRC32,
     } qCRC_Mode_t;
 
+    /**
+    * @brief A table-driven CRC engine object
+    * @details The instance should be initialized using the qCRCx_Setup() API.
+    * The engine holds a 256-entry lookup table precomputed for a single CRC
+    * configuration. Reflected configurations use a natively reflected table,
+    * so no per-byte reflection is performed.
+    * @note Do not access any member of this structure directly.
+    */
+    typedef struct
+    {
+        /*! @cond  */
+        uint32_t table[ 256 ];  /*-> byte-wise lookup table*/
+        const uint32_t *slice;  /*-> slicing tables ( QCRC32 only )*/
+        uint64_t fold[ 4 ];     /*-> carry-less folding constants ( QCRC32 only )*/
+        uint32_t poly;          /*-> polynomial ( not reflected )*/
+        uint32_t init;          /*-> initial value in the register domain*/
+        uint32_t xorOut;        /*-> final XOR value*/
+        uint32_t bitMask;       /*-> mask for the CRC width*/
+        uint8_t width;          /*-> CRC width in bits*/
+        uint8_t refIn;          /*-> the register operates in reflected form*/
+        uint8_t refSwap;        /*-> the register must be reflected at output*/
+        uint8_t nSlices;        /*-> number of slicing tables ( 0, 8 or 16 )*/
+        uint8_t accel;          /*-> selected hardware-accelerated path*/
+        /*! @endcond  */
+    } qCRC_Engine_t;
+
+    /**
+    * @brief A streaming CRC state object
+    * @details The instance should be initialized using the qCRCx_Init() API.
+    * @note Do not access any member of this structure directly.
+    */
+    typedef struct
+    {
+        /*! @cond  */
+        const qCRC_Engine_t *e; /*-> engine with the CRC configuration*/
+        uint32_t crc;           /*-> running register*/
+        /*! @endcond  */
+    } qCRC_State_t;
+
+    /**
+    * @brief A table-driven CRC engine object for any width from 3 to 64 bits
+    * @details The instance should be initialized using the qCRCn_Setup() API.
+    * The engine runs a 64-bit register, so it covers the CRCs that do not fit
+    * the ::qCRC_Mode_t values like CRC-5/USB, CRC-15/CAN, CRC-24/BLE or
+    * CRC-64/XZ.
+    * @note Do not access any member of this structure directly.
+    */
+    typedef struct
+    {
+        /*! @cond  */
+        uint64_t table[ 256 ];  /*-> byte-wise lookup table*/
+        uint64_t init;          /*-> initial value in the register domain*/
+        uint64_t xorOut;        /*-> final XOR value*/
+        uint64_t bitMask;       /*-> mask for the register width*/
+        uint8_t width;          /*-> CRC width in bits*/
+        uint8_t shift;          /*-> left alignment for non-reflected widths below 8 bits*/
+        uint8_t refIn;          /*-> the register operates in reflected form*/
+        uint8_t refSwap;        /*-> the register must be reflected at output*/
+        /*! @endcond  */
+    } qCRCn_Engine_t;
+
+    /**
+    * @brief A streaming CRC state object for the generic-width engine
+    * @details The instance should be initialized using the qCRCn_Init() API.
+    * @note Do not access any member of this structure directly.
+    */
+    typedef struct
+    {
+        /*! @cond  */
+        const qCRCn_Engine_t *e;    /*-> engine with the CRC configuration*/
+        uint64_t crc;               /*-> running register*/
+        /*! @endcond  */
+    } qCRCn_State_t;
+
+    /**
+    * @brief Use to determine the uint32_t array-size for the slicing tables
+    * of a CRC engine.
+    */
+    #define QCRC_SLICING_SIZE( NTABLES )    ( 256u*( NTABLES ) )
+
     /**
     * @brief Calculates in one pass the common @a width bit CRC value for a
     * block of data that is passed to the function together with a parameter
     * indicating the @a length.
+    * @note On x86 and AArch64 targets, long ::QCRC32 blocks are processed with
+    * the CPU CRC32C instructions when the polynomial is Castagnoli(0x1EDC6F41)
+    * and the input is reflected, or by carry-less multiplication folding
+    * (PCLMULQDQ / PMULL) for any other polynomial. The path is selected at
+    * runtime and the portable bitwise algorithm is used as fallback. Define
+    * QCRC_NO_HW_ACCEL to disable the hardware-accelerated paths.
     * @param[in] mode To select the CRC calculation mode. Only the following
     * values are supported: QCRC8, QCRC16 and QCRC32.
     * @param[in] pData A pointer to the block of data.
@@ -46,6 +132,225 @@ extern "C" {
                     const uint8_t refOut,
                     uint32_t xorOut );
 
+    /**
+    * @brief Setup a table-driven CRC engine by precomputing the lookup table
+    * for the given CRC configuration.
+    * @param[in] e A pointer to the CRC engine instance.
+    * @param[in] mode To select the CRC calculation mode. Only the following
+    * values are supported: QCRC8, QCRC16 and QCRC32.
+    * @param[in] poly CRC polynomial value.
+    * @param[in] init CRC initial value.
+    * @param[in] refIn If true, the input data is reflected before processing.
+    * @param[in] refOut If true, the CRC result is reflected before output.
+    * @param[in] xorOut The final XOR value.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qCRCx_Setup( qCRC_Engine_t * const e,
+                     const qCRC_Mode_t mode,
+                     uint32_t poly,
+                     const uint32_t init,
+                     const uint8_t refIn,
+                     const uint8_t refOut,
+                     const uint32_t xorOut );
+
+    /**
+    * @brief Enable the slicing-by-8 or slicing-by-16 path of a ::QCRC32 engine.
+    * The additional lookup tables are computed from the engine configuration
+    * and stored in the user-supplied @a area. Once enabled, qCRCx_Compute()
+    * processes 16 or 8 bytes per iteration for long buffers and falls back to
+    * the byte-wise algorithm for short buffers and the remaining tail.
+    * @note The engine must be configured with qCRCx_Setup() first.
+    * @param[in] e A pointer to the CRC engine instance.
+    * @param[in] area A pointer to the memory block to hold the tables. Should
+    * be an uint32_t array of size #QCRC_SLICING_SIZE(nTables).
+    * @param[in] nTables The number of slicing tables. Only 8 and 16 are
+    * supported.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qCRCx_SetSlicing( qCRC_Engine_t * const e,
+                          uint32_t * const area,
+                          const size_t nTables );
+
+    /**
+    * @brief Enable or disable the hardware-accelerated paths of a ::QCRC32
+    * engine. After qCRCx_Setup() the best available path is already enabled,
+    * so this is only needed to force the portable table or slicing paths,
+    * e.g. for benchmarking or to cross-check results.
+    * @param[in] e A pointer to the CRC engine instance.
+    * @param[in] enable If true, select the best hardware-accelerated path
+    * available on the running CPU, otherwise use the portable paths.
+    * @return 1 if the requested configuration is in effect, otherwise return 0.
+    */
+    int qCRCx_SetAccel( qCRC_Engine_t * const e,
+                        const uint8_t enable );
+
+    /**
+    * @brief Calculates in one pass the CRC value for a block of data by using
+    * the byte-wise table algorithm of the engine. The result is the same as
+    * the one obtained with qCRCx() for the same configuration.
+    * @param[in] e A pointer to the CRC engine instance.
+    * @param[in] pData A pointer to the block of data.
+    * @param[in] length The number of bytes in @a data.
+    * @return The CRC value for @a data.
+    */
+    uint32_t qCRCx_Compute( const qCRC_Engine_t * const e,
+                            const void * const pData,
+                            const size_t length );
+
+    /**
+    * @brief Start an incremental CRC calculation. The CRC can then be built
+    * across many non-contiguous chunks of data with qCRCx_Update() and
+    * obtained with qCRCx_Final().
+    * @param[in] s A pointer to the streaming CRC state.
+    * @param[in] e A pointer to the CRC engine instance with the configuration.
+    * The engine must remain valid while the state is in use.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qCRCx_Init( qCRC_State_t * const s,
+                    const qCRC_Engine_t * const e );
+
+    /**
+    * @brief Feed the next chunk of data to an incremental CRC calculation.
+    * @param[in] s A pointer to the streaming CRC state.
+    * @param[in] pData A pointer to the chunk of data.
+    * @param[in] length The number of bytes in @a data.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qCRCx_Update( qCRC_State_t * const s,
+                      const void * const pData,
+                      const size_t length );
+
+    /**
+    * @brief Get the result of an incremental CRC calculation by applying the
+    * output reflection and the final XOR value. The state is not modified, so
+    * more data can still be fed with qCRCx_Update().
+    * @param[in] s A pointer to the streaming CRC state.
+    * @return The CRC value for all the chunks fed so far.
+    */
+    uint32_t qCRCx_Final( const qCRC_State_t * const s );
+
+    /**
+    * @brief Combine the CRC values of two consecutive blocks of data A and B
+    * into the CRC value of the concatenation A|B, without reading the data
+    * again. The combination uses GF(2) matrix exponentiation, so its cost is
+    * logarithmic in @a lenB.
+    * @note Both @a crcA and @a crcB should be obtained with the same
+    * configuration of @a e.
+    * @param[in] crcA The CRC value of the first block.
+    * @param[in] crcB The CRC value of the second block.
+    * @param[in] lenB The number of bytes in the second block.
+    * @param[in] e A pointer to the CRC engine instance with the configuration.
+    * @return The CRC value of the concatenation of both blocks.
+    */
+    uint32_t qCRCx_Combine( const uint32_t crcA,
+                            const uint32_t crcB,
+                            size_t lenB,
+                            const qCRC_Engine_t * const e );
+
+    /**
+    * @brief Calculates the CRC values of a batch of independent messages. Four
+    * messages are processed per loop iteration with interleaved table lookups,
+    * which hides the latency of the serial dependency of each CRC. This is
+    * specially useful for large amounts of small messages.
+    * @param[in] e A pointer to the CRC engine instance.
+    * @param[in] bufs An array of @a n pointers to the messages.
+    * @param[in] lens An array of @a n elements with the number of bytes of
+    * each message.
+    * @param[out] out An array of @a n elements where the CRC values will be
+    * written. Each value is the same as the one obtained with qCRCx_Compute().
+    * @param[in] n The number of messages in the batch.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qCRCx_Batch( const qCRC_Engine_t * const e,
+                     const void * const bufs[],
+                     const size_t lens[],
+                     uint32_t out[],
+                     const size_t n );
+
+    /**
+    * @brief Calculates in one pass the CRC value of any width from 3 to 64
+    * bits for a block of data, by using the bitwise algorithm.
+    * @param[in] width The CRC width in bits [ 3 <= width <= 64 ].
+    * @param[in] pData A pointer to the block of data.
+    * @param[in] length The number of bytes in @a data.
+    * @param[in] poly CRC polynomial value.
+    * @param[in] init CRC initial value.
+    * @param[in] refIn If true, the input data is reflected before processing.
+    * @param[in] refOut If true, the CRC result is reflected before output.
+    * @param[in] xorOut The final XOR value.
+    * @return The CRC value for @a data.
+    */
+    uint64_t qCRCn( const uint8_t width,
+                    const void * const pData,
+                    const size_t length,
+                    uint64_t poly,
+                    const uint64_t init,
+                    const uint8_t refIn,
+                    const uint8_t refOut,
+                    uint64_t xorOut );
+
+    /**
+    * @brief Setup a generic-width CRC engine by precomputing the lookup table
+    * for the given CRC configuration.
+    * @param[in] e A pointer to the CRC engine instance.
+    * @param[in] width The CRC width in bits [ 3 <= width <= 64 ].
+    * @param[in] poly CRC polynomial value.
+    * @param[in] init CRC initial value.
+    * @param[in] refIn If true, the input data is reflected before processing.
+    * @param[in] refOut If true, the CRC result is reflected before output.
+    * @param[in] xorOut The final XOR value.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qCRCn_Setup( qCRCn_Engine_t * const e,
+                     const uint8_t width,
+                     uint64_t poly,
+                     const uint64_t init,
+                     const uint8_t refIn,
+                     const uint8_t refOut,
+                     const uint64_t xorOut );
+
+    /**
+    * @brief Calculates in one pass the CRC value for a block of data by using
+    * the byte-wise table algorithm of the generic-width engine. The result is
+    * the same as the one obtained with qCRCn() for the same configuration.
+    * @param[in] e A pointer to the CRC engine instance.
+    * @param[in] pData A pointer to the block of data.
+    * @param[in] length The number of bytes in @a data.
+    * @return The CRC value for @a data.
+    */
+    uint64_t qCRCn_Compute( const qCRCn_Engine_t * const e,
+                            const void * const pData,
+                            const size_t length );
+
+    /**
+    * @brief Start an incremental CRC calculation with a generic-width engine.
+    * @param[in] s A pointer to the streaming CRC state.
+    * @param[in] e A pointer to the CRC engine instance with the configuration.
+    * The engine must remain valid while the state is in use.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qCRCn_Init( qCRCn_State_t * const s,
+                    const qCRCn_Engine_t * const e );
+
+    /**
+    * @brief Feed the next chunk of data to an incremental CRC calculation.
+    * @param[in] s A pointer to the streaming CRC state.
+    * @param[in] pData A pointer to the chunk of data.
+    * @param[in] length The number of bytes in @a data.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qCRCn_Update( qCRCn_State_t * const s,
+                      const void * const pData,
+                      const size_t length );
+
+    /**
+    * @brief Get the result of an incremental CRC calculation by applying the
+    * output reflection and the final XOR value.
+    * @param[in] s A pointer to the streaming CRC state.
+    * @return The CRC value for all the chunks fed so far.
+    */
+    uint64_t qCRCn_Final( const qCRCn_State_t * const s );
+
 #ifdef __cplusplus
 }
 #endif
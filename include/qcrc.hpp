@@ -0,0 +1,285 @@
+/*!
+ * @file qcrc.hpp
+ * @author J. Camilo Gomez C.
+ * @version 1.00
+ * @note This file is part of the qLibs distribution.
+ * @brief Header-only C++ front end for the CRC library. The lookup table of
+ * each CRC configuration is generated at compile time, so predefined CRCs
+ * have no setup cost and the reflection branches are resolved by the
+ * compiler. Requires C++14 or later.
+ **/
+
+#ifndef QCRC_HPP
+#define QCRC_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+#include "qcrc.h"
+
+namespace qlibs {
+
+    /*! @cond  */
+    namespace crc_impl {
+        template <unsigned Width>
+        using word = typename std::conditional<( Width <= 8u ), std::uint8_t,
+                     typename std::conditional<( Width <= 16u ), std::uint16_t,
+                     typename std::conditional<( Width <= 32u ), std::uint32_t,
+                                               std::uint64_t>::type>::type>::type;
+
+        template <typename T>
+        struct table {
+            T v[ 256 ];
+        };
+
+        constexpr std::uint64_t mask( const unsigned Width )
+        {
+            return 0xFFFFFFFFFFFFFFFFuLL >> ( 64u - Width );
+        }
+
+        /*non-reflected widths below 8 bits run left-aligned in a byte*/
+        constexpr unsigned shift( const unsigned Width, const bool RefIn )
+        {
+            return ( ( !RefIn ) && ( Width < 8u ) ) ? ( 8u - Width ) : 0u;
+        }
+
+        constexpr std::uint64_t reflect( std::uint64_t x, const unsigned nBits )
+        {
+            std::uint64_t r = 0u;
+            for ( unsigned i = 0u ; i < nBits ; ++i ) {
+                r = ( r << 1u ) | ( x & 1u );
+                x >>= 1u;
+            }
+            return r;
+        }
+
+        template <typename T, unsigned Width, std::uint64_t Poly, bool RefIn>
+        constexpr table<T> generate()
+        {
+            constexpr unsigned s = shift( Width, RefIn );
+            constexpr unsigned rw = Width + s;
+            constexpr std::uint64_t rmask = mask( Width ) << s;
+            constexpr std::uint64_t topbit = 1uLL << ( rw - 1u );
+            constexpr std::uint64_t npoly = ( Poly & mask( Width ) ) << s;
+            constexpr std::uint64_t rpoly = reflect( Poly & mask( Width ), Width );
+            table<T> t{};
+            for ( std::uint64_t i = 0u ; i < 256u ; ++i ) {
+                std::uint64_t c = RefIn ? i : ( i << ( rw - 8u ) );
+                for ( unsigned b = 0u ; b < 8u ; ++b ) {
+                    if ( RefIn ) {
+                        c = ( 0u != ( c & 1u ) ) ? ( ( c >> 1u ) ^ rpoly ) : ( c >> 1u );
+                    }
+                    else {
+                        c = ( 0u != ( c & topbit ) ) ? ( ( c << 1u ) ^ npoly ) : ( c << 1u );
+                    }
+                }
+                t.v[ i ] = static_cast<T>( c & rmask );
+            }
+            return t;
+        }
+    }
+    /*! @endcond  */
+
+    /**
+    * @brief A CRC calculator whose configuration is given at compile time.
+    * @tparam Width The CRC width in bits [ 3 <= Width <= 64 ].
+    * @tparam Poly CRC polynomial value.
+    * @tparam Init CRC initial value.
+    * @tparam RefIn If true, the input data is reflected before processing.
+    * @tparam RefOut If true, the CRC result is reflected before output.
+    * @tparam XorOut The final XOR value.
+    * @note Results are the same as the ones obtained with qCRCn() for the
+    * same configuration, and with qCRCx() for the 8, 16 and 32 bits widths.
+    */
+    template <unsigned Width, std::uint64_t Poly, std::uint64_t Init,
+              bool RefIn, bool RefOut, std::uint64_t XorOut>
+    class crc {
+        static_assert( ( Width >= 3u ) && ( Width <= 64u ),
+                       "qlibs::crc only supports widths from 3 to 64 bits" );
+        public:
+            /** @brief The unsigned type holding the CRC value. */
+            using value_type = crc_impl::word<Width>;
+        private:
+            static constexpr std::uint64_t mask = crc_impl::mask( Width );
+            static constexpr unsigned shift = crc_impl::shift( Width, RefIn );
+            /*initial value in the register domain*/
+            static constexpr value_type regInit = static_cast<value_type>(
+                RefIn ? crc_impl::reflect( Init & mask, Width ) : ( ( Init & mask ) << shift ) );
+
+            static constexpr crc_impl::table<value_type> lut =
+                crc_impl::generate<value_type, Width, Poly, RefIn>();
+
+            value_type reg{ regInit };
+        public:
+            /**
+            * @brief Feed bytes into a CRC register.
+            * @param[in] r The register value, either from a previous call or
+            * from init().
+            * @param[in] data A pointer to the block of data.
+            * @param[in] length The number of bytes in @a data.
+            * @return The updated register value.
+            */
+            static constexpr value_type update( value_type r,
+                                                const std::uint8_t *data,
+                                                std::size_t length ) noexcept
+            {
+                std::uint64_t c = r;
+                for ( std::size_t i = 0u ; i < length ; ++i ) {
+                    if ( RefIn ) {
+                        c = lut.v[ ( c ^ data[ i ] ) & 0xFFu ] ^ ( c >> 8u );
+                    }
+                    else {
+                        c = lut.v[ ( ( c >> ( Width + shift - 8u ) ) ^ data[ i ] ) & 0xFFu ] ^ ( c << 8u );
+                    }
+                }
+                return static_cast<value_type>( c & ( mask << shift ) );
+            }
+
+            /**
+            * @brief The initial value of the CRC register.
+            */
+            static constexpr value_type init() noexcept
+            {
+                return regInit;
+            }
+
+            /**
+            * @brief Apply the output reflection and the final XOR value to a
+            * CRC register.
+            * @param[in] r The register value.
+            * @return The CRC value.
+            */
+            static constexpr value_type finalize( const value_type r ) noexcept
+            {
+                /*drop the left alignment before reflecting, as qCRCn does*/
+                const std::uint64_t a = static_cast<std::uint64_t>( r ) >> shift;
+                const std::uint64_t c = ( RefIn != RefOut ) ? crc_impl::reflect( a, Width ) : a;
+                return static_cast<value_type>( ( c ^ XorOut ) & mask );
+            }
+
+            /**
+            * @brief Calculates in one pass the CRC value for a block of data.
+            * @param[in] data A pointer to the block of data.
+            * @param[in] length The number of bytes in @a data.
+            * @return The CRC value for @a data.
+            */
+            static constexpr value_type compute( const std::uint8_t *data,
+                                                 std::size_t length ) noexcept
+            {
+                return finalize( update( regInit, data, length ) );
+            }
+
+            /**
+            * @brief Calculates in one pass the CRC value for a block of data.
+            * @param[in] data A pointer to the block of data.
+            * @param[in] length The number of bytes in @a data.
+            * @return The CRC value for @a data.
+            */
+            static value_type compute( const void *data,
+                                       std::size_t length ) noexcept
+            {
+                return compute( static_cast<const std::uint8_t*>( data ), length );
+            }
+
+            /**
+            * @brief The CRC value of the ASCII string "123456789", as found in
+            * CRC catalogues. Useful to validate a configuration at compile time.
+            */
+            static constexpr value_type check() noexcept
+            {
+                const std::uint8_t s[ 9 ] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+                return compute( s, sizeof(s) );
+            }
+
+            /**
+            * @brief Setup a qCRC engine with the same configuration, for
+            * example to use its slicing or hardware-accelerated paths. Only
+            * available for the 8, 16 and 32 bits widths.
+            * @param[in] e The CRC engine instance.
+            * @return 1 on success, otherwise return 0.
+            */
+            static int setup( qCRC_Engine_t &e ) noexcept
+            {
+                static_assert( ( 8u == Width ) || ( 16u == Width ) || ( 32u == Width ),
+                               "qCRC_Engine_t only supports 8, 16 and 32 bits widths" );
+                return qCRCx_Setup( &e, ( 8u == Width ) ? QCRC8 : ( ( 16u == Width ) ? QCRC16 : QCRC32 ),
+                                    static_cast<std::uint32_t>( Poly ),
+                                    static_cast<std::uint32_t>( Init ),
+                                    RefIn ? 1u : 0u, RefOut ? 1u : 0u,
+                                    static_cast<std::uint32_t>( XorOut ) );
+            }
+
+            /**
+            * @brief Setup a generic-width qCRC engine with the same
+            * configuration.
+            * @param[in] e The CRC engine instance.
+            * @return 1 on success, otherwise return 0.
+            */
+            static int setup( qCRCn_Engine_t &e ) noexcept
+            {
+                return qCRCn_Setup( &e, static_cast<std::uint8_t>( Width ), Poly, Init,
+                                    RefIn ? 1u : 0u, RefOut ? 1u : 0u, XorOut );
+            }
+
+            /**
+            * @brief Feed the next chunk of data to the incremental calculation
+            * of this instance.
+            * @param[in] data A pointer to the chunk of data.
+            * @param[in] length The number of bytes in @a data.
+            * @return A reference to this instance.
+            */
+            crc& update( const void *data,
+                         std::size_t length ) noexcept
+            {
+                reg = update( reg, static_cast<const std::uint8_t*>( data ), length );
+                return *this;
+            }
+
+            /**
+            * @brief Get the CRC value for all the chunks fed so far.
+            */
+            value_type value() const noexcept
+            {
+                return finalize( reg );
+            }
+
+            /**
+            * @brief Restart the incremental calculation of this instance.
+            */
+            void reset() noexcept
+            {
+                reg = regInit;
+            }
+    };
+
+    /*! @cond  */
+    template <unsigned Width, std::uint64_t Poly, std::uint64_t Init,
+              bool RefIn, bool RefOut, std::uint64_t XorOut>
+    constexpr crc_impl::table<typename crc<Width, Poly, Init, RefIn, RefOut, XorOut>::value_type>
+    crc<Width, Poly, Init, RefIn, RefOut, XorOut>::lut;
+    /*! @endcond  */
+
+    /** @brief CRC-8/MAXIM (Dallas 1-Wire) */
+    using crc8_maxim = crc<8u, 0x31u, 0x00u, true, true, 0x00u>;
+    /** @brief CRC-16/CCITT-FALSE */
+    using crc16_ccitt = crc<16u, 0x1021u, 0xFFFFu, false, false, 0x0000u>;
+    /** @brief CRC-16/MODBUS */
+    using crc16_modbus = crc<16u, 0x8005u, 0xFFFFu, true, true, 0x0000u>;
+    /** @brief CRC-32/ISO-HDLC (Ethernet, zlib) */
+    using crc32 = crc<32u, 0x04C11DB7u, 0xFFFFFFFFu, true, true, 0xFFFFFFFFu>;
+    /** @brief CRC-32C (Castagnoli) */
+    using crc32c = crc<32u, 0x1EDC6F41u, 0xFFFFFFFFu, true, true, 0xFFFFFFFFu>;
+    /** @brief CRC-5/USB */
+    using crc5_usb = crc<5u, 0x05u, 0x1Fu, true, true, 0x1Fu>;
+    /** @brief CRC-15/CAN */
+    using crc15_can = crc<15u, 0x4599u, 0x0000u, false, false, 0x0000u>;
+    /** @brief CRC-24/OPENPGP */
+    using crc24_openpgp = crc<24u, 0x864CFBu, 0xB704CEu, false, false, 0x000000u>;
+    /** @brief CRC-64/ECMA-182 */
+    using crc64_ecma = crc<64u, 0x42F0E1EBA9EA3693uLL, 0x0uLL, false, false, 0x0uLL>;
+    /** @brief CRC-64/XZ */
+    using crc64_xz = crc<64u, 0x42F0E1EBA9EA3693uLL, 0xFFFFFFFFFFFFFFFFuLL, true, true, 0xFFFFFFFFFFFFFFFFuLL>;
+
+}
+
+#endif
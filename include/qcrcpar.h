@@ -0,0 +1,82 @@
+/*!
+ * @file qcrcpar.h
+ * @author J. Camilo Gomez C.
+ * @version 1.00
+ * @note This file is part of the qLibs distribution.
+ * @brief Parallel CRC driver for large buffers and files. The data is split
+ * in contiguous segments that are checksummed by worker threads with a qCRC
+ * engine, and the partial results are merged in order with qCRCx_Combine().
+ * @note This module requires POSIX threads and memory-mapped files. It is
+ * optional and not needed to use qCRC.
+ **/
+
+#ifndef QCRCPAR_H
+#define QCRCPAR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    #include <stdlib.h>
+    #include <stdint.h>
+    #include "qcrc.h"
+
+    #ifndef QCRC_PAR_MAX_THREADS
+        /**
+        * @brief Maximum number of worker threads used by the parallel driver.
+        */
+        #define QCRC_PAR_MAX_THREADS    ( 64u )
+    #endif
+
+    #ifndef QCRC_PAR_CHUNK_SIZE
+        /**
+        * @brief Granularity of the segments handled by each worker thread in
+        * bytes. Segments are multiples of this size, so buffers smaller than
+        * two chunks are checksummed by the calling thread.
+        */
+        #define QCRC_PAR_CHUNK_SIZE     ( 262144u )
+    #endif
+
+    /**
+    * @brief Calculates the CRC value of a large block of data by using several
+    * threads. The result is the same as the one obtained with qCRCx_Compute()
+    * for the same engine.
+    * @note An empty block ( @a length equal to zero ) gives the CRC of an empty
+    * message, the same value that qCRCx_File() gives for an empty file and
+    * qCRCx_Final() gives when no data was fed, while qCRCx_Compute() returns
+    * 0 for it. @a pData may be NULL in this case.
+    * @param[in] e A pointer to the CRC engine instance.
+    * @param[in] pData A pointer to the block of data.
+    * @param[in] length The number of bytes in @a data.
+    * @param[in] nThreads The number of threads to use, including the calling
+    * thread. Pass 0 to use the number of online processors.
+    * @return The CRC value for @a data.
+    */
+    uint32_t qCRCx_Parallel( const qCRC_Engine_t * const e,
+                             const void * const pData,
+                             const size_t length,
+                             size_t nThreads );
+
+    /**
+    * @brief Calculates the CRC value of a file by mapping it into memory and
+    * using several threads. Files that cannot be mapped (e.g. pipes) are read
+    * sequentially.
+    * @param[in] e A pointer to the CRC engine instance.
+    * @param[in] path The path of the file.
+    * @param[in] nThreads The number of threads to use, including the calling
+    * thread. Pass 0 to use the number of online processors.
+    * @param[out] crc The CRC value of the file contents. For an empty file,
+    * this is the CRC of an empty message, as qCRCx_Parallel() gives for an
+    * empty block.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qCRCx_File( const qCRC_Engine_t * const e,
+                    const char * const path,
+                    const size_t nThreads,
+                    uint32_t * const crc );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
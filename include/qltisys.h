@@ -35,6 +35,48 @@ extern "C" {
         /*! @endcond  */
     } qLTISys_t;
 
+    #ifndef QLTISYS_FFTCONV_MIN_TAPS
+        /**
+        * @brief The minimum number of taps for which the block evaluation of
+        * a FIR filter switches to the FFT convolution engine. Below this size
+        * the direct form is faster.
+        */
+        #define QLTISYS_FFTCONV_MIN_TAPS    ( 64u )
+    #endif
+
+    /**
+    * @brief Use to determine a suitable FFT size for a FIR filter of @a NTAPS
+    * coefficients. Each block of the FFT convolution engine evaluates up to
+    * FFT size - @a NTAPS + 1 output samples.
+    */
+    #define QLTISYS_FFTCONV_SIZE( NTAPS )   ( QTDL_POW2_SIZE( 4u*( NTAPS ) ) )
+
+    /**
+    * @brief Use to determine the float array-size for the storage of a FFT
+    * convolution engine with a FFT of @a NFFT points.
+    */
+    #define QLTISYS_FFTCONV_AREA( NFFT )    ( 3u*( NFFT ) )
+
+    /**
+    * @brief A FFT convolution engine to evaluate long FIR filters by blocks
+    * using the overlap-save method.
+    * @details The instance should be initialized using the
+    * qLTISys_FFTConv_Setup() API.
+    * @note Besides the spectrum of the coefficients, the engine holds the
+    * working frame of the transforms, so each filter needs its own engine.
+    * @note Do not access any member of this structure directly.
+    */
+    typedef struct
+    {
+        /*! @cond  */
+        float *h;       /*-> spectrum of the coefficients, scaled by 1/nfft*/
+        float *buf;     /*-> frame being transformed*/
+        float *tw;      /*-> twiddle factors*/
+        size_t nfft;    /*-> number of points of the FFT*/
+        size_t ntaps;   /*-> number of coefficients*/
+        /*! @endcond  */
+    } qLTISys_FFTConv_t;
+
     /**
     * @brief Drives the LTI system recursively using the input signal provided
     * @note The user must ensure that this function is executed in the time
@@ -125,12 +167,119 @@ extern "C" {
     * @param[in] wsize The number of elements of @a w.
     * @return If @a c is provided, returns the evaluation of the FIR filter.
     * otherwise return the sum of the updated window @a w.
+    * @note On x86 and AArch64 targets, the dot product of long windows uses
+    * SSE2, AVX2/FMA, AVX-512 or NEON kernels selected at runtime. The vector
+    * kernels accumulate in a different order, so results may differ from the
+    * portable path in the last bits. Define QLTISYS_NO_SIMD to disable them.
     */
     float qLTISys_DiscreteFIRUpdate( float *w,
                                      const float * const c,
                                      const size_t wsize,
                                      const float x );
 
+    /**
+    * @brief Evaluate the discrete FIR filter by inserting @a x in the circular
+    * window @a w of size @a wsize. The oldest sample gets overwritten and
+    * no sample is moved, so each update costs a single write besides the
+    * dot product. The output is the same as the one of
+    * qLTISys_DiscreteFIRUpdate() with the coefficients in reverse order.
+    * @param[in,out] w An array of @a wsize elements that holds the circular
+    * window with the delay lines of @a x.
+    * @param[in] rc An array of @a wsize elements with the coefficients of the
+    * FIR filter in reverse order, i.e. @a rc[0] multiplies the oldest sample
+    * and @a rc[wsize-1] the most recent one. To ignore pass NULL.
+    * @param[in] wsize The number of elements of @a w.
+    * @param[in,out] idx A pointer to the index of the oldest sample in @a w.
+    * It should be initialized to zero along with the window and it is updated
+    * on every call.
+    * @param[in] x The new sample.
+    * @return If @a rc is provided, returns the evaluation of the FIR filter.
+    * otherwise return the sum of the updated window @a w.
+    */
+    float qLTISys_DiscreteFIRRingUpdate( float *w,
+                                         const float * const rc,
+                                         const size_t wsize,
+                                         size_t * const idx,
+                                         const float x );
+
+    /**
+    * @brief Evaluate a discrete FIR filter with symmetric coefficients
+    * ( linear phase ) by inserting @a x in the circular window @a w of size
+    * @a wsize. On the portable path, the samples that share a coefficient are
+    * added before the multiplication, which halves the number of multiplies.
+    * When the SIMD kernels are available, the plain dot product is used since
+    * it is already faster. The output is the same as the one of
+    * qLTISys_DiscreteFIRRingUpdate().
+    * @param[in,out] w An array of @a wsize elements that holds the circular
+    * window with the delay lines of @a x.
+    * @param[in] c An array of @a wsize elements with the coefficients of the
+    * FIR filter. They must be symmetric, i.e. c[i] == c[wsize-1-i].
+    * @param[in] wsize The number of elements of @a w.
+    * @param[in,out] idx A pointer to the index of the oldest sample in @a w.
+    * It should be initialized to zero along with the window and it is updated
+    * on every call.
+    * @param[in] x The new sample.
+    * @return The evaluation of the FIR filter.
+    */
+    float qLTISys_DiscreteFIRSymRingUpdate( float *w,
+                                            const float * const c,
+                                            const size_t wsize,
+                                            size_t * const idx,
+                                            const float x );
+
+    /**
+    * @brief Setup a FFT convolution engine for the coefficients of a FIR
+    * filter. The spectrum of the coefficients is computed once here.
+    * @param[in] e A pointer to the FFT convolution engine instance.
+    * @param[in] area An array of #QLTISYS_FFTCONV_AREA(@a nfft) elements to
+    * hold the spectrum, the working frame and the twiddle factors.
+    * @param[in] nfft The number of points of the FFT. Must be a power of two,
+    * at least twice @a ntaps. #QLTISYS_FFTCONV_SIZE(@a ntaps) is a good
+    * trade-off between memory and speed.
+    * @param[in] rc An array of @a ntaps elements with the coefficients of the
+    * FIR filter in reverse order, as for qLTISys_DiscreteFIRRingUpdate().
+    * @param[in] ntaps The number of coefficients.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qLTISys_FFTConv_Setup( qLTISys_FFTConv_t * const e,
+                               float * const area,
+                               const size_t nfft,
+                               const float * const rc,
+                               const size_t ntaps );
+
+    /**
+    * @brief Evaluate the discrete FIR filter for a block of samples by
+    * inserting them in the circular window @a w of size @a wsize. The output
+    * and the final window are the same as calling
+    * qLTISys_DiscreteFIRRingUpdate() for each sample, but when a FFT
+    * convolution engine is supplied and the filter has at least
+    * #QLTISYS_FFTCONV_MIN_TAPS coefficients, long blocks are evaluated by
+    * overlap-save FFT convolution in O(log n) per sample.
+    * @param[in,out] w An array of @a wsize elements that holds the circular
+    * window with the delay lines of @a x.
+    * @param[in] rc An array of @a wsize elements with the coefficients of the
+    * FIR filter in reverse order.
+    * @param[in] wsize The number of elements of @a w.
+    * @param[in,out] idx A pointer to the index of the oldest sample in @a w.
+    * @param[in] x An array of @a n samples of the input signal.
+    * @param[out] y An array of @a n elements to store the output. It can be the
+    * same array as @a x.
+    * @param[in] n The number of samples to process.
+    * @param[in,out] e A pointer to a FFT convolution engine configured with
+    * the same coefficients, or NULL to always use the direct form. The engine
+    * holds the working frame of the transforms, so it must be used by a
+    * single filter, even if other filters have the same coefficients.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qLTISys_DiscreteFIRRingBlock( float *w,
+                                      const float * const rc,
+                                      const size_t wsize,
+                                      size_t * const idx,
+                                      const float * const x,
+                                      float * const y,
+                                      const size_t n,
+                                      qLTISys_FFTConv_t * const e );
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,76 @@
+/*!
+ * @file qsimd.h
+ * @author J. Camilo Gomez C.
+ * @version 1.00
+ * @note This file is part of the qLibs distribution.
+ * @brief Runtime selection of the SIMD kernels used by the library modules.
+ * This header is internal to the library and it is not needed to use any of
+ * the APIs.
+ * @note Define QSIMD_DISABLE before including this header to build the
+ * including module without the vector kernels.
+ **/
+
+#ifndef QSIMD_H
+#define QSIMD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    #include <stdint.h>
+
+    /*! @cond  */
+    #if !defined( QSIMD_DISABLE ) && defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+        #define QSIMD_X86
+        #include <immintrin.h>
+    #elif !defined( QSIMD_DISABLE ) && defined( __GNUC__ ) && defined( __aarch64__ ) && defined( __ARM_NEON )
+        #define QSIMD_ARM
+        #include <arm_neon.h>
+    #endif
+
+    #if defined( QSIMD_X86 ) || defined( QSIMD_ARM )
+        #define QSIMD
+    #endif
+
+    #define QSIMD_NONE          ( 0u )
+    #define QSIMD_SSE2          ( 1u )
+    #define QSIMD_AVX2          ( 2u )
+    #define QSIMD_AVX512        ( 3u )
+    #define QSIMD_NEON          ( 4u )
+
+    /*the features are detected by the runtime before main(), so this is just
+    a lookup and there is no state to share between threads*/
+    static inline uint8_t qSIMD_Select( void )
+    {
+        uint8_t simd;
+
+        #if defined( QSIMD_X86 )
+            if ( 0 != __builtin_cpu_supports( "avx512f" ) ) {
+                simd = QSIMD_AVX512;
+            }
+            else if ( ( 0 != __builtin_cpu_supports( "avx2" ) ) &&
+                      ( 0 != __builtin_cpu_supports( "fma" ) ) ) {
+                simd = QSIMD_AVX2;
+            }
+            else if ( 0 != __builtin_cpu_supports( "sse2" ) ) {
+                simd = QSIMD_SSE2;
+            }
+            else {
+                simd = QSIMD_NONE;
+            }
+        #elif defined( QSIMD_ARM )
+            /*on AArch64 NEON is always available*/
+            simd = QSIMD_NEON;
+        #else
+            simd = QSIMD_NONE;
+        #endif
+
+        return simd;
+    }
+    /*! @endcond  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
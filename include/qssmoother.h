@@ -18,19 +18,54 @@ extern "C" {
     #include <float.h>
     #include <math.h>
     #include "qtdl.h"
+    #include "qltisys.h"
 
     typedef enum {
         QSSMOOTHER_TYPE_LPF1 = 0,   /*< Low-Pass filter 1st Order*/
         QSSMOOTHER_TYPE_LPF2,       /*< Low-Pass filter 2nd Order*/
-        QSSMOOTHER_TYPE_MWM1,       /*< Moving Window Median filter ( O(n) time )*/
-        QSSMOOTHER_TYPE_MWM2,       /*< Moving Window Median filter ( O(1) time by using a TDL )*/
-        QSSMOOTHER_TYPE_MOR1,       /*< Moving Outliers Removal ( O(n) time )*/
+        QSSMOOTHER_TYPE_MWM1,       /*< Moving Window Mean filter ( O(n) time, without moving the window )*/
+        QSSMOOTHER_TYPE_MWM2,       /*< Moving Window Mean filter ( O(1) time by using a TDL )*/
+        QSSMOOTHER_TYPE_MOR1,       /*< Moving Outliers Removal ( O(n) time, without moving the window )*/
         QSSMOOTHER_TYPE_MOR2,       /*< Moving Outliers Removal ( O(1) time by using a TDL )*/
         QSSMOOTHER_TYPE_GMWF,       /*< Gaussian Filter*/
         QSSMOOTHER_TYPE_KLMN,       /*< Kalman Filter*/
         QSSMOOTHER_TYPE_EXPW,       /*< Exponential weighting filter*/
+        QSSMOOTHER_TYPE_MEDN,       /*< Moving Window Median ( O(log n) time by using a two-heap structure )*/
+        QSSMOOTHER_TYPE_HMPL,       /*< Hampel filter, Moving Outliers Removal by the median and the MAD ( O(log^2 n) time by using an order-statistic tree )*/
+        QSSMOOTHER_TYPE_MMAX,       /*< Moving Window Min/Max/Range ( O(1) amortized time by using monotonic deques )*/
+        QSSMOOTHER_TYPE_SOS,        /*< Cascade of Second-Order Sections ( transposed direct form II biquads )*/
     }qSSmoother_Type_t;
 
+    typedef enum {
+        QSSMOOTHER_SOS_BUTTERWORTH = 0, /*< Maximally flat passband*/
+        QSSMOOTHER_SOS_CHEBYSHEV1,      /*< Equiripple passband, sharper transition*/
+    }qSSmoother_SOS_Proto_t;
+
+    typedef enum {
+        QSSMOOTHER_SOS_LOWPASS = 0, /*< Low-Pass*/
+        QSSMOOTHER_SOS_HIGHPASS,    /*< High-Pass*/
+        QSSMOOTHER_SOS_BANDPASS,    /*< Band-Pass*/
+        QSSMOOTHER_SOS_BANDSTOP,    /*< Band-Stop ( notch )*/
+    }qSSmoother_SOS_Band_t;
+
+    /**
+    * @brief The number of elements of the coefficients array of a
+    * ::QSSMOOTHER_TYPE_SOS filter of order @a ORDER.
+    */
+    #define QSSMOOTHER_SOS_COEFFS( ORDER )          ( 1u + ( 5u*(ORDER) ) )
+
+    /**
+    * @brief The number of elements of the window of a ::QSSMOOTHER_TYPE_SOS
+    * smoother of order @a ORDER.
+    */
+    #define QSSMOOTHER_SOS_WINDOW( ORDER )          ( 7u*(ORDER) )
+
+    /**
+    * @brief The number of elements of the area of a ::QSSMOOTHER_TYPE_SOS
+    * bank of order @a ORDER with @a NC channels.
+    */
+    #define QSSMOOTHER_SOS_BANK_AREA( ORDER, NC )   ( ( 5u + ( 2u*(NC) ) )*(ORDER) )
+
     #define qSSmootherPtr_t  void
 
     /*! @cond  */
@@ -64,7 +99,7 @@ extern "C" {
         /*! @cond  */
         _qSSmoother_t f;
         float *w;
-        size_t wsize;
+        size_t wsize, idx;
         /*! @endcond  */
     } qSSmoother_MWM1_t;
 
@@ -82,7 +117,7 @@ extern "C" {
         /*! @cond  */
         _qSSmoother_t f;
         float *w, m, alpha;
-        size_t wsize;
+        size_t wsize, idx;
         /*! @endcond  */
     } qSSmoother_MOR1_t;
 
@@ -100,7 +135,9 @@ extern "C" {
         /*! @cond  */
         _qSSmoother_t f;
         float *w, *k;
-        size_t wsize;
+        size_t wsize, idx;
+        uint8_t sym;    /* the kernel is symmetric */
+        qLTISys_FFTConv_t fft; /* block engine, disabled if fft.h is NULL */
         /*! @endcond  */
     } qSSmoother_GMWF_t;
 
@@ -126,6 +163,117 @@ extern "C" {
         /*! @endcond  */
     } qSSmoother_KLMN_t;
 
+    typedef struct
+    {
+        /*! @cond  */
+        _qSSmoother_t f;
+        float *w;       /* circular window with the samples */
+        float *pos;     /* int32_t position in the heap of each sample */
+        float *heap;    /* int32_t sample indexes, centered at the median */
+        size_t wsize;   /* window length */
+        size_t idx;     /* index of the oldest sample */
+        /*! @endcond  */
+    } qSSmoother_MEDN_t;
+
+    typedef struct
+    {
+        /*! @cond  */
+        _qSSmoother_t f;
+        float *w;       /* circular window with the samples */
+        float *t;       /* int32_t links, size and priority of each tree node */
+        float k;        /* threshold in units of the MAD */
+        size_t wsize;   /* window length */
+        size_t idx;     /* index of the oldest sample */
+        int32_t root;   /* root node of the tree */
+        uint32_t seed;  /* state of the priority generator */
+        /*! @endcond  */
+    } qSSmoother_HMPL_t;
+
+    typedef struct
+    {
+        /*! @cond  */
+        _qSSmoother_t f;
+        float *q;       /* value and uint32_t time of the max-deque, then the min-deque */
+        size_t wsize;   /* window length */
+        size_t hMax, nMax, hMin, nMin; /* head and length of each deque */
+        uint32_t t;     /* time of the next sample */
+        float min, max;
+        uint8_t out;    /* 0: min, 1: max, 2: range */
+        /*! @endcond  */
+    } qSSmoother_MMAX_t;
+
+    typedef struct
+    {
+        /*! @cond  */
+        _qSSmoother_t f;
+        float *c;       /* b0, b1, b2, a1, a2 of each section */
+        float *d;       /* the two delays of each section */
+        size_t ns;      /* number of sections */
+        uint8_t simd;   /* SIMD kernel of the block processing */
+        /*! @endcond  */
+    } qSSmoother_SOS_t;
+
+    #define qSSmootherBankPtr_t  void
+
+    /*! @cond  */
+    /*abstract class of the multi-channel banks*/
+    typedef struct _qSSmoother_Bank_s
+    {
+        void *vt;
+        size_t nc;      /* number of channels */
+        uint8_t init;
+        uint8_t simd;   /* SIMD kernel in use */
+    } _qSSmoother_Bank_t;
+    /*! @endcond  */
+
+    typedef struct
+    {
+        /*! @cond  */
+        _qSSmoother_Bank_t b;
+        float *y1;      /* output of each channel */
+        float alpha;
+        /*! @endcond  */
+    } qSSmoother_LPF1_Bank_t;
+
+    typedef struct
+    {
+        /*! @cond  */
+        _qSSmoother_Bank_t b;
+        float *x1, *x2, *y1, *y2;   /* delays of each channel, swapped on every frame */
+        float k, a1, a2, b1;
+        /*! @endcond  */
+    } qSSmoother_LPF2_Bank_t;
+
+    typedef struct
+    {
+        /*! @cond  */
+        _qSSmoother_Bank_t b;
+        float *m;       /* weighted mean of each channel */
+        float lambda;
+        float w;        /* does not depend on the samples, shared by all the channels */
+        /*! @endcond  */
+    } qSSmoother_EXPW_Bank_t;
+
+    typedef struct
+    {
+        /*! @cond  */
+        _qSSmoother_Bank_t b;
+        float *x;       /* state of each channel */
+        float q, r;
+        float p, gain;  /* do not depend on the samples, shared by all the channels */
+        /*! @endcond  */
+    } qSSmoother_KLMN_Bank_t;
+
+    typedef struct
+    {
+        /*! @cond  */
+        _qSSmoother_Bank_t b;
+        float *c;       /* b0, b1, b2, a1, a2 of each section */
+        float *d;       /* the two delays of each section, one array of nc for each */
+        size_t ns;      /* number of sections */
+        /*! @endcond  */
+    } qSSmoother_SOS_Bank_t;
+
     /**
     * @brief Check if the smoother filter is initialized.
     * @param[in] s A pointer to the signal smoother instance.
@@ -149,6 +297,121 @@ extern "C" {
     float qSSmoother_Perform( qSSmootherPtr_t * const s,
                               const float x );
 
+    /**
+    * @brief Perform the smooth operation for a block of samples of the input
+    * signal. The output is the same as calling qSSmoother_Perform() for each
+    * sample, but the filter is dispatched once and its state is kept in local
+    * variables during the whole block.
+    * @param[in] s A pointer to the signal smoother instance.
+    * @param[in] x An array of @a n samples of the input signal.
+    * @param[out] y An array of @a n elements to store the smoothed output. It
+    * can be the same array as @a x.
+    * @param[in] n The number of samples to process.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qSSmoother_PerformBlock( qSSmootherPtr_t * const s,
+                                 const float * const x,
+                                 float * const y,
+                                 const size_t n );
+
+    /**
+    * @brief Enable the FFT convolution engine for the block processing of a
+    * ::QSSMOOTHER_TYPE_GMWF smoother. With it, qSSmoother_PerformBlock()
+    * evaluates long blocks by overlap-save FFT convolution in O(log n) per
+    * sample. The engine is only used when the window has at least
+    * #QLTISYS_FFTCONV_MIN_TAPS elements, otherwise the direct form is kept.
+    * qSSmoother_Perform() always uses the direct form.
+    * @note Must be called after qSSmoother_Setup(), since the spectrum of the
+    * gaussian kernel is computed here. A new setup disables the engine.
+    * @param[in] s A pointer to the ::QSSMOOTHER_TYPE_GMWF smoother instance.
+    * @param[in] area An array of #QLTISYS_FFTCONV_AREA(@a nfft) elements.
+    * @param[in] nfft The number of points of the FFT. Must be a power of two,
+    * at least twice the window length. Use #QLTISYS_FFTCONV_SIZE(wsize/2).
+    * @return 1 on success, otherwise return 0.
+    */
+    int qSSmoother_GMWF_SetFFT( qSSmoother_GMWF_t * const s,
+                                float * const area,
+                                const size_t nfft );
+
+    /**
+    * @brief Get both the minimum and the maximum of the window of a
+    * ::QSSMOOTHER_TYPE_MMAX smoother after the last performed sample.
+    * @param[in] s A pointer to the ::QSSMOOTHER_TYPE_MMAX smoother instance.
+    * @param[out] min Where the minimum will be stored. Can be NULL.
+    * @param[out] max Where the maximum will be stored. Can be NULL.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qSSmoother_MMAX_GetEnvelope( const qSSmoother_MMAX_t * const s,
+                                     float * const min,
+                                     float * const max );
+
+    /**
+    * @brief Perform the smooth operation for one frame of a multi-channel
+    * signal, where each channel has its own ::QSSMOOTHER_TYPE_MMAX smoother.
+    * The channels are processed in a single call without the dispatch cost of
+    * calling qSSmoother_Perform() for each one.
+    * @param[in] s An array of @a nc ::QSSMOOTHER_TYPE_MMAX smoother instances,
+    * one for each channel. All of them should be already configured.
+    * @param[in] nc The number of channels.
+    * @param[in] x An array of @a nc elements with a sample of each channel.
+    * @param[out] y An array of @a nc elements to store the output of each
+    * channel. It can be the same array as @a x.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qSSmoother_MMAX_PerformFrame( qSSmoother_MMAX_t * const s,
+                                      const size_t nc,
+                                      const float * const x,
+                                      float * const y );
+
+    /**
+    * @brief Design the coefficients of a ::QSSMOOTHER_TYPE_SOS filter from an
+    * analog prototype by the bilinear transform, with the band edges
+    * pre-warped. Each section is normalized to unity gain at DC for the
+    * low-pass and band-stop filters, at Nyquist for the high-pass filters and
+    * at the center frequency for the band-pass filters, where the gain of a
+    * Chebyshev filter of even order is the bottom of its ripple.
+    * @param[out] c An array of #QSSMOOTHER_SOS_COEFFS( @a order ) elements
+    * to store the number of sections followed by their coefficients. Low-pass
+    * and high-pass filters use ( @a order + 1 )/2 sections, band-pass and
+    * band-stop filters use @a order sections.
+    * @param[in] proto The analog prototype. Use one of the following values:
+    * ::QSSMOOTHER_SOS_BUTTERWORTH, ::QSSMOOTHER_SOS_CHEBYSHEV1.
+    * @param[in] band The kind of filter. Use one of the following values:
+    * ::QSSMOOTHER_SOS_LOWPASS, ::QSSMOOTHER_SOS_HIGHPASS,
+    * ::QSSMOOTHER_SOS_BANDPASS, ::QSSMOOTHER_SOS_BANDSTOP.
+    * @param[in] order The order of the prototype [ order > 0 ]. Band-pass and
+    * band-stop filters have twice this order.
+    * @param[in] f1 The cutoff frequency, or the lower edge of the band, as a
+    * fraction of the sampling frequency [ 0 < f1 < 0.5 ]. For a Chebyshev
+    * filter, this is the edge of the ripple band.
+    * @param[in] f2 The upper edge of the band as a fraction of the sampling
+    * frequency [ f1 < f2 < 0.5 ]. Ignored for low-pass and high-pass filters.
+    * @param[in] ripple The passband ripple in dB of a Chebyshev filter
+    * [ ripple > 0 ]. Ignored for a Butterworth filter.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qSSmoother_SOS_Design( float * const c,
+                               const qSSmoother_SOS_Proto_t proto,
+                               const qSSmoother_SOS_Band_t band,
+                               const size_t order,
+                               const float f1,
+                               const float f2,
+                               const float ripple );
+
+    /**
+    * @brief Enable or disable the SIMD kernels used by qSSmoother_PerformBlock()
+    * on a ::QSSMOOTHER_TYPE_SOS smoother, which process four sections at a
+    * time. After qSSmoother_Setup() the best kernel available on the running
+    * CPU is already selected, so this is only needed to force the portable
+    * path, e.g. for benchmarking or to cross-check results.
+    * @param[in] s A pointer to the ::QSSMOOTHER_TYPE_SOS smoother instance.
+    * @param[in] enable If true, select the best SIMD kernel available on the
+    * running CPU, otherwise use the portable path.
+    * @return 1 if the requested configuration is in effect, otherwise return 0.
+    */
+    int qSSmoother_SOS_SetAccel( qSSmoother_SOS_t * const s,
+                                 const uint8_t enable );
+
     /**
     * @brief Setup an initialize smoother filter.
     * @param[in] s A pointer to the signal smoother instance.
@@ -172,6 +435,14 @@ extern "C" {
     *
     * - ::QSSMOOTHER_TYPE_EXPW.
     *
+    * - ::QSSMOOTHER_TYPE_MEDN.
+    *
+    * - ::QSSMOOTHER_TYPE_HMPL.
+    *
+    * - ::QSSMOOTHER_TYPE_MMAX.
+    *
+    * - ::QSSMOOTHER_TYPE_SOS.
+    *
     * @param[in] param The smoother parameters. Depends of the type selected:
     *
     * if ::QSSMOOTHER_TYPE_LPF1, a pointer to a value between  [ 0 < alpha < 1 ]
@@ -198,6 +469,20 @@ extern "C" {
     * if ::QSSMOOTHER_TYPE_EXPW, a pointer to a value between [ 0 < lambda < 1 ]
     * that represents the forgetting factor.
     *
+    * if ::QSSMOOTHER_TYPE_MEDN, can be ignored. Pass NULL as argument.
+    *
+    * if ::QSSMOOTHER_TYPE_HMPL, a pointer to the threshold [ t > 0 ] in
+    * standard deviations. A sample is an outlier when its distance to the
+    * median of the window exceeds t*1.4826*MAD. A typical value is 3.
+    *
+    * if ::QSSMOOTHER_TYPE_MMAX, a pointer to the selected output: 0 for the
+    * minimum, 1 for the maximum or 2 for the range ( max - min ) of the window.
+    *
+    * if ::QSSMOOTHER_TYPE_SOS, an array with the number of sections followed
+    * by the coefficients b0, b1, b2, a1, a2 of each section, where a0 = 1. It
+    * can be obtained with qSSmoother_SOS_Design(). The coefficients are
+    * copied to @a window, and the sections should be stable.
+    *
     * @param[in] window The filter window and coefficients. Depends of the type
     * selected:
     *
@@ -220,6 +505,22 @@ extern "C" {
     *
     * if ::QSSMOOTHER_TYPE_EXPW, can be ignored. Pass NULL as argument.
     *
+    * if ::QSSMOOTHER_TYPE_MEDN, An array of 3x the window length to hold the
+    * samples and the indexes of the two heaps that keep track of the median.
+    * The window length is @a wsize / 3.
+    *
+    * if ::QSSMOOTHER_TYPE_HMPL, An array of 6x the window length to hold the
+    * samples and the nodes of the tree that keeps them sorted. The window
+    * length is @a wsize / 6.
+    *
+    * if ::QSSMOOTHER_TYPE_MMAX, An array of 4x the window length to hold the
+    * two deques with the candidates to the minimum and the maximum. The window
+    * length is @a wsize / 4.
+    *
+    * if ::QSSMOOTHER_TYPE_SOS, An array of 7x the number of sections to hold
+    * the coefficients and the delays of each section. An array of
+    * #QSSMOOTHER_SOS_WINDOW( order ) elements is always enough.
+    *
     * @param[in] wsize If used, the number of elements in @a window, otherwise
     * pass 0uL as argument.
     * @return 1 on success, otherwise return 0.
@@ -230,6 +531,97 @@ extern "C" {
                           float *window,
                           const size_t wsize );
 
+    /**
+    * @brief Setup and initialize a bank of smoother filters, one for each
+    * channel of a multi-channel signal. All the channels share the same
+    * parameters, while the state of the channels is stored in @a area as one
+    * array per state variable (structure of arrays). This way, each frame is
+    * processed with vector instructions over several channels at a time.
+    * @param[in] b A pointer to the bank instance.
+    * @param[in] type The filter type. Use one of the following values:
+    *
+    * - ::QSSMOOTHER_TYPE_LPF1, with a ::qSSmoother_LPF1_Bank_t instance.
+    *
+    * - ::QSSMOOTHER_TYPE_LPF2, with a ::qSSmoother_LPF2_Bank_t instance.
+    *
+    * - ::QSSMOOTHER_TYPE_KLMN, with a ::qSSmoother_KLMN_Bank_t instance.
+    *
+    * - ::QSSMOOTHER_TYPE_EXPW, with a ::qSSmoother_EXPW_Bank_t instance.
+    *
+    * - ::QSSMOOTHER_TYPE_SOS, with a ::qSSmoother_SOS_Bank_t instance.
+    *
+    * @param[in] param The smoother parameters, the same as in
+    * qSSmoother_Setup().
+    * @param[in] area An array to hold the state of the channels. Must have
+    * 4x @a nc elements if ::QSSMOOTHER_TYPE_LPF2, ( 5 + 2x @a nc ) x the
+    * number of sections if ::QSSMOOTHER_TYPE_SOS, which is covered by
+    * #QSSMOOTHER_SOS_BANK_AREA( order, nc ), otherwise @a nc elements.
+    * @param[in] nc The number of channels.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qSSmoother_Bank_Setup( qSSmootherBankPtr_t * const b,
+                               const qSSmoother_Type_t type,
+                               const float * const param,
+                               float *area,
+                               const size_t nc );
+
+    /**
+    * @brief Reset all the channels of a smoother bank.
+    * @param[in] b A pointer to the bank instance.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qSSmoother_Bank_Reset( qSSmootherBankPtr_t * const b );
+
+    /**
+    * @brief Perform the smooth operation for one frame of the multi-channel
+    * signal. The output of each channel is the same as the one of a single
+    * smoother of the same type fed with the samples of that channel.
+    * @param[in] b A pointer to the bank instance.
+    * @param[in] x An array of @a nc elements with a sample of each channel.
+    * @param[out] y An array of @a nc elements to store the output of each
+    * channel. It can be the same array as @a x.
+    * @return 1 on success, otherwise return 0.
+    * @note On x86 and AArch64 targets, the channels are processed with SSE2,
+    * AVX2, AVX-512 or NEON kernels selected by qSSmoother_Bank_Setup() for
+    * the running CPU, see qSSmoother_Bank_SetAccel(). The compiler may
+    * fuse the operations differently in each path, so results may differ
+    * from the portable path in the last bits. Define QSSMOOTHER_NO_SIMD to
+    * disable them.
+    */
+    int qSSmoother_Bank_PerformFrame( qSSmootherBankPtr_t * const b,
+                                      const float * const x,
+                                      float * const y );
+
+    /**
+    * @brief Perform the smooth operation for @a n consecutive frames of the
+    * multi-channel signal. The output is the same as calling
+    * qSSmoother_Bank_PerformFrame() for each frame.
+    * @param[in] b A pointer to the bank instance.
+    * @param[in] x An array of @a n x @a nc elements with the frames one after
+    * the other, i.e. the sample @a t of the channel @a c is x[ t*nc + c ].
+    * @param[out] y An array of @a n x @a nc elements to store the output
+    * frames with the same layout. It can be the same array as @a x.
+    * @param[in] n The number of frames to process.
+    * @return 1 on success, otherwise return 0.
+    */
+    int qSSmoother_Bank_PerformBlock( qSSmootherBankPtr_t * const b,
+                                      const float * const x,
+                                      float * const y,
+                                      const size_t n );
+
+    /**
+    * @brief Enable or disable the SIMD kernels of a smoother bank. After
+    * qSSmoother_Bank_Setup() the best kernel available on the running CPU is
+    * already selected, so this is only needed to force the portable path,
+    * e.g. for benchmarking or to cross-check results.
+    * @param[in] b A pointer to the smoother bank instance.
+    * @param[in] enable If true, select the best SIMD kernel available on the
+    * running CPU, otherwise use the portable path.
+    * @return 1 if the requested configuration is in effect, otherwise return 0.
+    */
+    int qSSmoother_Bank_SetAccel( qSSmootherBankPtr_t * const b,
+                                  const uint8_t enable );
+
 
 #ifdef __cplusplus
 }
@@ -8,6 +8,10 @@
  * delay length values.
  * This class runs in constant time O(1), so it becomes useful when you need to
  * work with long delayed lines.
+ * Besides the float ::qTDL_t, the families qTDL_i16_t ( raw ADC samples ),
+ * qTDL_i32_t ( also for qFP16_t ), qTDL_f64_t and qTDL_cf32_t ( float
+ * complex ) are provided, and others can be generated with QTDL_DECLARE()
+ * and QTDL_DEFINE().
  **/
 
 #ifndef QTDL_H
@@ -32,6 +36,7 @@ extern "C" {
         float *head, *tail;
         float *rd, *wr;
         size_t itemcount;
+        uint8_t mirror;
     } qTDL_t;
 
     /**
@@ -48,6 +53,22 @@ extern "C" {
                      const size_t n,
                      const float initval );
 
+    /**
+    * @brief Setup and initialize a mirrored Tapped Delay Line (TDL) instance.
+    * Each sample is written twice, at its slot and at the same slot shifted by
+    * @a n, so the whole delay line can always be read as a contiguous window
+    * with qTDL_GetWindow().
+    * @param[in] q A pointer to the TDL instance.
+    * @param[in] area An array of size 2*@a n where delays will be stored
+    * @param[in] n The number of delays of the TDL.
+    * @param[in] initval The value with which all TDL delays will be initialized
+    * @return none
+    */
+    void qTDL_SetupMirrored( qTDL_t * const q,
+                             float * const area,
+                             const size_t n,
+                             const float initval );
+
     /**
     * @brief Clears all delays from the TDL and sets them to the specified value
     * @param[in] q A pointer to the TDL instance.
@@ -88,6 +109,300 @@ extern "C" {
     void qTDL_InsertSample( qTDL_t * const q,
                             const float sample );
 
+    /**
+    * @brief Insert a block of new samples to the TDL removing the same number
+    * of the oldest samples. The result is the same as calling
+    * qTDL_InsertSample() for each element of @a src, but the data is copied
+    * with at most two memcpy() segments ( four for a mirrored TDL ).
+    * @param[in] q A pointer to the TDL instance.
+    * @param[in] src The block of samples, ordered from the oldest to the most
+    * recent. If @a n exceeds the TDL length, only the last samples are kept.
+    * @param[in] n The number of samples in @a src.
+    * @return none
+    */
+    void qTDL_InsertBlock( qTDL_t * const q,
+                           const float * const src,
+                           const size_t n );
+
+    /**
+    * @brief Copy a block of consecutive samples from the TDL in chronological
+    * order, by using at most two memcpy() segments.
+    * @param[in] q A pointer to the TDL instance.
+    * @param[in] start The position of the first sample to copy, counted from
+    * the oldest sample x(k-n+1), so 0 is the oldest sample.
+    * @param[out] dst The destination array of at least @a n elements.
+    * @param[in] n The number of samples to copy.
+    * @return 1 on success, otherwise return 0 if the requested block exceeds
+    * the TDL length.
+    */
+    int qTDL_ReadBlock( const qTDL_t * const q,
+                        const size_t start,
+                        float * const dst,
+                        const size_t n );
+
+    /**
+    * @brief Get the contents of a mirrored TDL as a contiguous window of
+    * samples, ordered from the oldest x(k-n+1) to the most recent x(k).
+    * @note The window is valid until the next insertion.
+    * @param[in] q A pointer to the TDL instance.
+    * @return A pointer to the first of the n samples of the window. NULL if
+    * the TDL was not configured with qTDL_SetupMirrored().
+    */
+    const float* qTDL_GetWindow( const qTDL_t * const q );
+
+    /*! @endcond  */
+
+    /*! @cond  */
+    #define QTDL_POW2_S1_( x )  ( ( x ) | ( ( x ) >> 1u ) )
+    #define QTDL_POW2_S2_( x )  ( QTDL_POW2_S1_( x ) | ( QTDL_POW2_S1_( x ) >> 2u ) )
+    #define QTDL_POW2_S4_( x )  ( QTDL_POW2_S2_( x ) | ( QTDL_POW2_S2_( x ) >> 4u ) )
+    #define QTDL_POW2_S8_( x )  ( QTDL_POW2_S4_( x ) | ( QTDL_POW2_S4_( x ) >> 8u ) )
+    #define QTDL_POW2_S16_( x ) ( QTDL_POW2_S8_( x ) | ( QTDL_POW2_S8_( x ) >> 16u ) )
+    /*! @endcond  */
+
+    /**
+    * @brief Use to determine the float array-size for a power-of-two TDL of
+    * @a N delays, that is, @a N rounded up to the next power of two.
+    * @note @a N should be a constant expression between 1 and 2^31.
+    */
+    #define QTDL_POW2_SIZE( N ) ( QTDL_POW2_S16_( (uint32_t)( N ) - 1uL ) + 1uL )
+
+    /**
+    * @brief A power-of-two Tapped Delay Line (TDL) object
+    * @details The instance should be initialized using the qTDL_Pow2_Setup()
+    * API. The storage has a power-of-two size and the insertions are counted
+    * by a free-running write counter, so every access is a branchless masked
+    * index.
+    * @note Do not access any member of this structure directly.
+    */
+    typedef struct
+    {
+        /*! @cond  */
+        float *head;        /*-> storage of #QTDL_POW2_SIZE(itemcount) elements*/
+        size_t mask;        /*-> storage size - 1*/
+        size_t wr;          /*-> free-running write counter*/
+        size_t itemcount;   /*-> number of delays*/
+        /*! @endcond  */
+    } qTDL_Pow2_t;
+
+    /**
+    * @brief Setup and initialize a power-of-two Tapped Delay Line (TDL)
+    * instance.
+    * @param[in] q A pointer to the TDL instance.
+    * @param[in] area An array of size #QTDL_POW2_SIZE(@a n) where delays will
+    * be stored
+    * @param[in] n The number of delays of the TDL.
+    * @param[in] initval The value with which all TDL delays will be initialized
+    * @return none
+    */
+    void qTDL_Pow2_Setup( qTDL_Pow2_t * const q,
+                          float * const area,
+                          const size_t n,
+                          const float initval );
+
+    /**
+    * @brief Clears all delays from the TDL and sets them to the specified value
+    * @param[in] q A pointer to the TDL instance.
+    * @param[in] initval The value with which all TDL delays will be initialized
+    * @return none
+    */
+    void qTDL_Pow2_Flush( qTDL_Pow2_t * const q,
+                          const float initval );
+
+    /**
+    * @brief Get the oldest sample from the TDL x(k-n)
+    * @param[in] q A pointer to the TDL instance.
+    * @return The requested value from the TDL
+    */
+    float qTDL_Pow2_GetOldest( const qTDL_Pow2_t * const q );
+
+    /**
+    * @brief Get the specified delayed sample from the TDL x(k-i)
+    * @param[in] q A pointer to the TDL instance.
+    * @param[in] i The requested delay index
+    * @return The requested value from the TDL
+    */
+    float qTDL_Pow2_GetAtIndex( const qTDL_Pow2_t * const q,
+                                const size_t i );
+
+    /**
+    * @brief Get the most recent sample from the TDL x(k)
+    * @param[in] q A pointer to the TDL instance.
+    * @return The requested value from the TDL
+    */
+    float qTDL_Pow2_GetRecent( const qTDL_Pow2_t * const q );
+
+    /**
+    * @brief Insert a new sample to the TDL removing the oldest sample
+    * @param[in] q A pointer to the TDL instance.
+    * @param[in] sample The new sample.
+    * @return none
+    */
+    void qTDL_Pow2_InsertSample( qTDL_Pow2_t * const q,
+                                 const float sample );
+
+    /**
+    * @brief A multi-channel Tapped Delay Line (TDL) bank object
+    * @details The instance should be initialized using the qTDL_Bank_Setup()
+    * API. The M channels by N delays are kept in a single area, where the
+    * samples of all the channels at the same delay ( a frame ) are
+    * contiguous, so a whole frame is inserted or read with a single block
+    * copy.
+    * @note Do not access any member of this structure directly.
+    */
+    typedef struct
+    {
+        /*! @cond  */
+        float *head;        /*-> storage of nChannels*itemcount elements*/
+        size_t nChannels;   /*-> number of channels ( frame length )*/
+        size_t itemcount;   /*-> number of delays*/
+        size_t wr;          /*-> index of the oldest frame, the next to write*/
+        /*! @endcond  */
+    } qTDL_Bank_t;
+
+    /**
+    * @brief Setup and initialize a multi-channel Tapped Delay Line (TDL) bank.
+    * @param[in] b A pointer to the TDL bank instance.
+    * @param[in] area An array of size @a m * @a n where delays will be stored
+    * @param[in] m The number of channels.
+    * @param[in] n The number of delays of each channel.
+    * @param[in] initval The value with which all TDL delays will be initialized
+    * @return none
+    */
+    void qTDL_Bank_Setup( qTDL_Bank_t * const b,
+                          float * const area,
+                          const size_t m,
+                          const size_t n,
+                          const float initval );
+
+    /**
+    * @brief Clears all delays from the TDL bank and sets them to the specified
+    * value
+    * @param[in] b A pointer to the TDL bank instance.
+    * @param[in] initval The value with which all TDL delays will be initialized
+    * @return none
+    */
+    void qTDL_Bank_Flush( qTDL_Bank_t * const b,
+                          const float initval );
+
+    /**
+    * @brief Insert a new frame, one sample per channel, to the TDL bank
+    * removing the oldest frame.
+    * @param[in] b A pointer to the TDL bank instance.
+    * @param[in] frame An array with the new sample of each channel.
+    * @return none
+    */
+    void qTDL_Bank_InsertFrame( qTDL_Bank_t * const b,
+                                const float * const frame );
+
+    /**
+    * @brief Copy the oldest frame x(k-n) from the TDL bank, one sample per
+    * channel.
+    * @param[in] b A pointer to the TDL bank instance.
+    * @param[out] frame An array of at least m elements.
+    * @return none
+    */
+    void qTDL_Bank_GetOldestFrame( const qTDL_Bank_t * const b,
+                                   float * const frame );
+
+    /**
+    * @brief Get the specified delayed frame x(k-i) from the TDL bank without
+    * copying it.
+    * @note The frame is valid until the next insertion.
+    * @param[in] b A pointer to the TDL bank instance.
+    * @param[in] i The requested delay index
+    * @return A pointer to the m samples of the frame.
+    */
+    const float* qTDL_Bank_GetFrame( const qTDL_Bank_t * const b,
+                                     const size_t i );
+
+    /**
+    * @brief Get the specified delayed sample x(k-i) of a single channel from
+    * the TDL bank
+    * @param[in] b A pointer to the TDL bank instance.
+    * @param[in] channel The channel index.
+    * @param[in] i The requested delay index
+    * @return The requested value from the TDL bank
+    */
+    float qTDL_Bank_GetAtIndex( const qTDL_Bank_t * const b,
+                                const size_t channel,
+                                const size_t i );
+
+    /**
+    * @brief Declare a Tapped Delay Line (TDL) family for the element type
+    * @a TYPE. It declares the @a NAME##_t object type and the functions
+    * NAME##_Setup(), NAME##_Flush(), NAME##_GetOldest(), NAME##_GetAtIndex(),
+    * NAME##_GetRecent() and NAME##_InsertSample(), which have the same O(1)
+    * semantics as the ::qTDL_t ones. Use it in a header file.
+    * @note The implementation must be generated once with QTDL_DEFINE().
+    * @param NAME The prefix for the generated type and functions.
+    * @param TYPE The element type. Any type that can be copied by assignment.
+    */
+    #define QTDL_DECLARE( NAME, TYPE )                                      \
+    typedef struct                                                          \
+    {                                                                       \
+        TYPE *head;                                                         \
+        size_t itemcount, wr;                                               \
+    } NAME##_t;                                                             \
+    void NAME##_Setup( NAME##_t * const q, TYPE * const area,               \
+                       const size_t n, const TYPE initval );                \
+    void NAME##_Flush( NAME##_t * const q, const TYPE initval );            \
+    TYPE NAME##_GetOldest( const NAME##_t * const q );                      \
+    TYPE NAME##_GetAtIndex( const NAME##_t * const q, const size_t i );     \
+    TYPE NAME##_GetRecent( const NAME##_t * const q );                      \
+    void NAME##_InsertSample( NAME##_t * const q, const TYPE sample )       \
+
+    /**
+    * @brief Generate the implementation of a TDL family previously declared
+    * with QTDL_DECLARE(). Use it in exactly one source file.
+    * @param NAME The prefix for the generated type and functions.
+    * @param TYPE The element type.
+    */
+    #define QTDL_DEFINE( NAME, TYPE )                                       \
+    void NAME##_Setup( NAME##_t * const q, TYPE * const area,               \
+                       const size_t n, const TYPE initval )                 \
+    {                                                                       \
+        q->head = area;                                                     \
+        q->itemcount = n;                                                   \
+        NAME##_Flush( q, initval );                                         \
+    }                                                                       \
+    void NAME##_Flush( NAME##_t * const q, const TYPE initval )             \
+    {                                                                       \
+        size_t i;                                                           \
+        for ( i = 0u ; i < q->itemcount ; ++i ) {                           \
+            q->head[ i ] = initval;                                         \
+        }                                                                   \
+        q->wr = 0u;                                                         \
+    }                                                                       \
+    TYPE NAME##_GetOldest( const NAME##_t * const q )                       \
+    {                                                                       \
+        return q->head[ q->wr ];                                            \
+    }                                                                       \
+    TYPE NAME##_GetAtIndex( const NAME##_t * const q, const size_t i )      \
+    {                                                                       \
+        /*the most recent sample is right before the write slot*/           \
+        return ( i < q->wr )? q->head[ q->wr - 1u - i ]                     \
+                            : q->head[ ( q->itemcount + q->wr ) - 1u - i ]; \
+    }                                                                       \
+    TYPE NAME##_GetRecent( const NAME##_t * const q )                       \
+    {                                                                       \
+        return NAME##_GetAtIndex( q, 0u );                                  \
+    }                                                                       \
+    void NAME##_InsertSample( NAME##_t * const q, const TYPE sample )       \
+    {                                                                       \
+        q->head[ q->wr ] = sample; /*overwrite the oldest sample*/          \
+        if ( ++q->wr >= q->itemcount ) {                                    \
+            q->wr = 0u;                                                     \
+        }                                                                   \
+    }                                                                       \
+
+    /*! @cond  */
+    QTDL_DECLARE( qTDL_i16, int16_t );
+    QTDL_DECLARE( qTDL_i32, int32_t );
+    QTDL_DECLARE( qTDL_f64, double );
+    #if !defined( __cplusplus ) && !defined( __STDC_NO_COMPLEX__ )
+        QTDL_DECLARE( qTDL_cf32, float _Complex );
+    #endif
     /*! @endcond  */
 
 #ifdef __cplusplus
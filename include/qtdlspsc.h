@@ -0,0 +1,126 @@
+/*!
+ * @file qtdlspsc.h
+ * @author J. Camilo Gomez C.
+ * @version 1.00
+ * @note This file is part of the qLibs distribution.
+ * @brief Lock-free Tapped Delay Line (TDL) to hand samples from one producer
+ * thread to one consumer thread. The producer inserts samples without ever
+ * blocking and the consumer takes wait-free snapshots of the most recent
+ * samples. Snapshots that were overrun by the producer are detected and
+ * reported, so the consumer can simply try again.
+ * @note This module requires C11 atomics. It is optional and not needed to
+ * use qTDL.
+ **/
+
+#ifndef QTDLSPSC_H
+#define QTDLSPSC_H
+
+#if !defined( __STDC_VERSION__ ) || ( __STDC_VERSION__ < 201112L ) || defined( __STDC_NO_ATOMICS__ )
+    #error "qtdlspsc requires a C11 compiler with atomics support"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    #include <stdlib.h>
+    #include <stdint.h>
+    #include <stdatomic.h>
+
+    #ifndef QTDL_SPSC_CACHE_LINE
+        /**
+        * @brief Size of the cache line in bytes. The indexes written by the
+        * producer are placed in their own cache line to avoid false sharing.
+        */
+        #define QTDL_SPSC_CACHE_LINE    ( 64u )
+    #endif
+
+    /**
+    * @brief A slot of a lock-free TDL. It holds the bit pattern of a float
+    * sample, so the producer and the consumer can access it concurrently.
+    */
+    typedef _Atomic uint32_t qTDL_SPSC_Slot_t;
+
+    /**
+    * @brief A lock-free single-producer/single-consumer TDL object
+    * @details The instance should be initialized using the qTDL_SPSC_Setup()
+    * API.
+    * @note Do not access any member of this structure directly.
+    */
+    typedef struct
+    {
+        /*! @cond  */
+        qTDL_SPSC_Slot_t *head;     /*-> storage, read-only after setup*/
+        size_t size;                /*-> number of slots, a power of two*/
+        size_t mask;                /*-> size - 1*/
+        _Alignas( QTDL_SPSC_CACHE_LINE ) atomic_size_t claim;  /*-> slots being written by the producer*/
+        atomic_size_t count;        /*-> slots already published by the producer*/
+        char pad[ QTDL_SPSC_CACHE_LINE - ( 2u*sizeof(atomic_size_t) ) ];
+        /*! @endcond  */
+    } qTDL_SPSC_t;
+
+    /**
+    * @brief Setup and initialize a lock-free TDL instance. Must be called
+    * before the producer and consumer threads start using the instance.
+    * @param[in] q A pointer to the TDL instance.
+    * @param[in] area An array of size @a n where samples will be stored.
+    * Every slot is an atomic object, since the consumer may read a slot while
+    * the producer overwrites it.
+    * @param[in] n The number of elements on @a area. Must be a power of two.
+    * Snapshots of up to @a n samples can be taken, but the slack between the
+    * snapshot length and @a n is what lets the producer keep inserting while
+    * the consumer copies, so twice the snapshot length is recommended.
+    * @param[in] initval The value with which all TDL delays will be initialized
+    * @return 1 on success, otherwise return 0.
+    */
+    int qTDL_SPSC_Setup( qTDL_SPSC_t * const q,
+                         qTDL_SPSC_Slot_t * const area,
+                         const size_t n,
+                         const float initval );
+
+    /**
+    * @brief Insert a new sample to the TDL removing the oldest sample. Only
+    * the producer thread can call this function. It never blocks.
+    * @param[in] q A pointer to the TDL instance.
+    * @param[in] sample The new sample.
+    * @return none
+    */
+    void qTDL_SPSC_InsertSample( qTDL_SPSC_t * const q,
+                                 const float sample );
+
+    /**
+    * @brief Insert a block of new samples to the TDL removing the same number
+    * of the oldest samples. Only the producer thread can call this function.
+    * It never blocks.
+    * @param[in] q A pointer to the TDL instance.
+    * @param[in] src The block of samples, ordered from the oldest to the most
+    * recent. If @a n exceeds the TDL size, only the last samples are kept.
+    * @param[in] n The number of samples in @a src.
+    * @return none
+    */
+    void qTDL_SPSC_InsertBlock( qTDL_SPSC_t * const q,
+                                const float * const src,
+                                const size_t n );
+
+    /**
+    * @brief Take a snapshot of the most recent samples of the TDL in
+    * chronological order. Only the consumer thread can call this function.
+    * The call is wait-free: it copies the samples once and then checks that
+    * the producer did not overwrite any of them in the meantime.
+    * @param[in] q A pointer to the TDL instance.
+    * @param[out] dst The destination array of at least @a n elements. Its
+    * contents are unspecified when the function fails.
+    * @param[in] n The number of samples to copy. Should not exceed the size of
+    * the TDL.
+    * @return 1 if @a dst holds a consistent snapshot, otherwise return 0 if
+    * it was overrun by the producer and should be taken again.
+    */
+    int qTDL_SPSC_Snapshot( qTDL_SPSC_t * const q,
+                            float * const dst,
+                            const size_t n );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
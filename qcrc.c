@@ -5,9 +5,98 @@
  **/
 
 #include "qcrc.h"
+#include <string.h>
+
+#if !defined( QCRC_NO_HW_ACCEL ) && defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+    #define QCRC_ACCEL_X86
+    #include <immintrin.h>
+#elif !defined( QCRC_NO_HW_ACCEL ) && defined( __GNUC__ ) && defined( __aarch64__ ) && ( defined( __ARM_FEATURE_CRYPTO ) || defined( __ARM_FEATURE_AES ) )
+    #define QCRC_ACCEL_ARM
+    #include <arm_neon.h>
+    #if defined( __ARM_FEATURE_CRC32 )
+        #include <arm_acle.h>
+    #endif
+#endif
+
+#if defined( QCRC_ACCEL_X86 ) || defined( QCRC_ACCEL_ARM )
+    #define QCRC_ACCEL
+    #define QCRC_ACCEL_NONE                 ( 0u )
+    #define QCRC_ACCEL_CRC32C               ( 1u )
+    #define QCRC_ACCEL_CLMUL                ( 2u )
+    #define QCRC_ACCEL_MIN_LENGTH           ( 64u )
+    #define QCRC_ACCEL_MIN_LENGTH_BITWISE   ( 256u )
+    #define QCRC_POLY_CASTAGNOLI            ( 0x1EDC6F41uL )
+#endif
 
 static uint32_t qCRCx_Reflect( uint32_t data,
                                const uint8_t nBits );
+static uint32_t qCRCx_BitwiseUpdate( uint32_t crc,
+                                     const uint8_t * const msg,
+                                     const size_t length,
+                                     const uint32_t poly,
+                                     const uint32_t width,
+                                     const uint8_t refIn );
+static uint32_t qCRCx_TableUpdate( const qCRC_Engine_t * const e,
+                                   uint32_t crc,
+                                   const uint8_t * const msg,
+                                   const size_t length );
+static uint32_t qCRCx_SliceUpdate( const qCRC_Engine_t * const e,
+                                   uint32_t crc,
+                                   const uint8_t * msg,
+                                   size_t * const length );
+static uint32_t qCRCx_EngineUpdate( const qCRC_Engine_t * const e,
+                                    uint32_t crc,
+                                    const uint8_t * const msg,
+                                    const size_t length );
+static uint32_t qCRCx_EngineFinal( const qCRC_Engine_t * const e,
+                                   uint32_t crc );
+static uint32_t qCRCx_MatrixTimes( const uint32_t * const mat,
+                                   uint32_t vec );
+static void qCRCx_MatrixSquare( uint32_t * const square,
+                                const uint32_t * const mat,
+                                const uint8_t width );
+static size_t qCRCx_BatchNext( const void * const bufs[],
+                               const size_t lens[],
+                               uint32_t out[],
+                               size_t next,
+                               const size_t n );
+static uint64_t qCRCn_Reflect( uint64_t xData,
+                               const uint8_t nBits );
+static uint64_t qCRCn_TableUpdate( const qCRCn_Engine_t * const e,
+                                   uint64_t crc,
+                                   const uint8_t * const msg,
+                                   const size_t length );
+static uint64_t qCRCn_EngineFinal( const qCRCn_Engine_t * const e,
+                                   uint64_t crc );
+#if defined( QCRC_ACCEL )
+static uint8_t qCRCx_AccelFeatures( void );
+static uint8_t qCRCx_AccelSelect( const uint32_t poly,
+                                  const uint8_t refIn,
+                                  uint64_t * const k );
+static size_t qCRCx_AccelUpdate( const uint8_t accel,
+                                 const uint64_t * const k,
+                                 const uint8_t refIn,
+                                 uint32_t * const crc,
+                                 const uint8_t * const msg,
+                                 const size_t length,
+                                 uint8_t * const folded );
+static uint32_t qCRCx_CRC32C( uint32_t crc,
+                              const uint8_t *msg,
+                              size_t length );
+static size_t qCRCx_FoldCLMUL( const uint64_t * const k,
+                               const uint8_t refIn,
+                               const uint32_t crc,
+                               const uint8_t * const msg,
+                               const size_t length,
+                               uint8_t * const folded );
+#if defined( QCRC_ACCEL_ARM )
+static uint8x16_t qCRCx_FoldPMULL( const uint8x16_t x,
+                                   const uint8x16_t y,
+                                   const uint64_t * const k );
+static uint8x16_t qCRCx_LoadPMULL( const uint8_t * const msg,
+                                   const uint8_t refIn );
+#endif
+#endif
 
 /*============================================================================*/
 static uint32_t qCRCx_Reflect( uint32_t xData,
@@ -29,6 +118,35 @@ static uint32_t qCRCx_Reflect( uint32_t xData,
     return r;
 }
 /*============================================================================*/
+static uint32_t qCRCx_BitwiseUpdate( uint32_t crc,
+                                     const uint8_t * const msg,
+                                     const size_t length,
+                                     const uint32_t poly,
+                                     const uint32_t width,
+                                     const uint8_t refIn )
+{
+    size_t i;
+    uint8_t xBit;
+    const uint32_t wd1 = (uint32_t)width - 8u;
+    const uint32_t topbit = 1uL << ( width - 1uL );
+
+    /*Perform modulo-2 division, a byte at a time. */
+    for ( i = 0u ; i < length ; ++i ) {
+        /*cstat -CERT-INT34-C_a*/
+        crc ^= ( 0u != refIn )?
+               ( qCRCx_Reflect( (uint32_t)msg[ i ], 8u ) <<  wd1 ) :
+               ( (uint32_t)msg[ i ] << wd1 );
+        /*cstat +CERT-INT34-C_a*/
+        for ( xBit = 8u ; xBit > 0u ; --xBit ) {
+            /*try to divide the current data bit*/
+            crc = ( 0u != ( crc & topbit ) )? ( ( crc << 1u ) ^ poly )
+                                            : ( crc << 1u );
+        }
+    }
+
+    return crc;
+}
+/*============================================================================*/
 uint32_t qCRCx( const qCRC_Mode_t mode,
                 const void * const pData,
                 const size_t length,
@@ -42,32 +160,35 @@ uint32_t qCRCx( const qCRC_Mode_t mode,
     /*cstat -ATH-cmp-unsign-pos*/
     if ( ( NULL != pData ) && ( length > 0u ) && ( mode >= QCRC8 ) && ( mode <= QCRC32 ) ) {
     /*cstat +ATH-cmp-unsign-pos*/
-        size_t i;
-        uint8_t xBit;
+        size_t i = 0u;
         const uint32_t widthValues[ 3 ] = { 8uL, 16uL, 32uL };
         const uint32_t width = widthValues[ mode ];
         /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
         uint8_t const * const msg = pData;
         /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
-        const uint32_t wd1 = (uint32_t)width - 8u;
-        const uint32_t topbit = 1uL << ( width - 1uL );
         const uint32_t bitMask = ( 0xFFFFFFFFuL >> ( 32uL - width ) );
         poly &= bitMask;
         xorOut &= bitMask;
         crc = init;
-        /*Perform modulo-2 division, a byte at a time. */
-        for ( i = 0u ; i < length ; ++i ) {
-            /*cstat -CERT-INT34-C_a*/
-            crc ^= ( 0u != refIn )?
-                   ( qCRCx_Reflect( (uint32_t)msg[ i ], 8u ) <<  wd1 ) :
-                   ( (uint32_t)msg[ i ] << wd1 );
-            /*cstat +CERT-INT34-C_a*/
-            for ( xBit = 8u ; xBit > 0u ; --xBit ) {
-                /*try to divide the current data bit*/
-                crc = ( 0u != ( crc & topbit ) )? ( ( crc << 1u ) ^ poly )
-                                                : ( crc << 1u );
+        #if defined( QCRC_ACCEL )
+        if ( ( QCRC32 == mode ) && ( length >= QCRC_ACCEL_MIN_LENGTH_BITWISE ) ) {
+            uint64_t k[ 4 ];
+            const uint8_t accel = qCRCx_AccelSelect( poly, refIn, k );
+
+            if ( QCRC_ACCEL_NONE != accel ) {
+                uint8_t folded[ 16 ];
+                /*the accelerated kernels run the register in the input domain*/
+                uint32_t r = ( 0u != refIn )? qCRCx_Reflect( init, 32u ) : init;
+
+                i = qCRCx_AccelUpdate( accel, k, refIn, &r, msg, length, folded );
+                crc = ( 0u != refIn )? qCRCx_Reflect( r, 32u ) : r;
+                if ( QCRC_ACCEL_CLMUL == accel ) {
+                    crc = qCRCx_BitwiseUpdate( crc, folded, sizeof(folded), poly, width, refIn );
+                }
             }
         }
+        #endif
+        crc = qCRCx_BitwiseUpdate( crc, &msg[ i ], length - i, poly, width, refIn );
         crc = ( 0u != refOut )? ( qCRCx_Reflect( crc, (uint8_t)width )^xorOut )
                               : ( crc^xorOut );
         crc &= bitMask;
@@ -76,3 +197,1057 @@ uint32_t qCRCx( const qCRC_Mode_t mode,
     return crc;
 }
 /*============================================================================*/
+int qCRCx_Setup( qCRC_Engine_t * const e,
+                 const qCRC_Mode_t mode,
+                 uint32_t poly,
+                 const uint32_t init,
+                 const uint8_t refIn,
+                 const uint8_t refOut,
+                 const uint32_t xorOut )
+{
+    int retValue = 0;
+    /*cstat -ATH-cmp-unsign-pos*/
+    if ( ( NULL != e ) && ( mode >= QCRC8 ) && ( mode <= QCRC32 ) ) {
+    /*cstat +ATH-cmp-unsign-pos*/
+        uint32_t i, crc;
+        uint8_t xBit;
+        const uint8_t widthValues[ 3 ] = { 8u, 16u, 32u };
+        const uint8_t width = widthValues[ mode ];
+        const uint32_t wd1 = (uint32_t)width - 8u;
+        const uint32_t topbit = 1uL << ( width - 1u );
+        const uint32_t bitMask = ( 0xFFFFFFFFuL >> ( 32u - width ) );
+
+        poly &= bitMask;
+        e->poly = poly;
+        e->width = width;
+        e->bitMask = bitMask;
+        e->xorOut = xorOut & bitMask;
+        e->slice = NULL;
+        e->nSlices = 0u;
+        e->accel = 0u;
+        e->refIn = ( 0u != refIn )? 1u : 0u;
+        /*the register is reflected at output only if refIn and refOut differ*/
+        e->refSwap = ( ( 0u != refIn ) != ( 0u != refOut ) )? 1u : 0u;
+        if ( 0u != e->refIn ) {
+            /*natively reflected table: the register runs LSB-first*/
+            const uint32_t rpoly = qCRCx_Reflect( poly, width );
+            e->init = qCRCx_Reflect( init & bitMask, width );
+            for ( i = 0u ; i < 256u ; ++i ) {
+                crc = i;
+                for ( xBit = 8u ; xBit > 0u ; --xBit ) {
+                    crc = ( 0u != ( crc & 1u ) )? ( ( crc >> 1u ) ^ rpoly )
+                                                : ( crc >> 1u );
+                }
+                e->table[ i ] = crc;
+            }
+        }
+        else {
+            e->init = init & bitMask;
+            for ( i = 0u ; i < 256u ; ++i ) {
+                /*cstat -CERT-INT34-C_a*/
+                crc = i << wd1;
+                /*cstat +CERT-INT34-C_a*/
+                for ( xBit = 8u ; xBit > 0u ; --xBit ) {
+                    crc = ( 0u != ( crc & topbit ) )? ( ( crc << 1u ) ^ poly )
+                                                    : ( crc << 1u );
+                }
+                e->table[ i ] = crc & bitMask;
+            }
+        }
+        #if defined( QCRC_ACCEL )
+        if ( 32u == width ) {
+            e->accel = qCRCx_AccelSelect( poly, e->refIn, e->fold );
+        }
+        #endif
+        retValue = 1;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+int qCRCx_SetSlicing( qCRC_Engine_t * const e,
+                      uint32_t * const area,
+                      const size_t nTables )
+{
+    int retValue = 0;
+
+    if ( ( NULL != e ) && ( NULL != area ) && ( 32u == e->width ) &&
+         ( ( 8u == nTables ) || ( 16u == nTables ) ) ) {
+        size_t i, k;
+        uint32_t c;
+        /*table k holds the CRC of a byte followed by k zero bytes*/
+        for ( i = 0u ; i < 256u ; ++i ) {
+            area[ i ] = e->table[ i ];
+        }
+        for ( k = 1u ; k < nTables ; ++k ) {
+            for ( i = 0u ; i < 256u ; ++i ) {
+                c = area[ ( ( k - 1u )*256u ) + i ];
+                area[ ( k*256u ) + i ] = ( 0u != e->refIn )?
+                                         ( ( c >> 8u ) ^ e->table[ c & 0xFFu ] ) :
+                                         ( ( c << 8u ) ^ e->table[ c >> 24u ] );
+            }
+        }
+        e->slice = area;
+        /*cstat -MISRAC2012-Rule-10.3*/
+        e->nSlices = (uint8_t)nTables;
+        /*cstat +MISRAC2012-Rule-10.3*/
+        retValue = 1;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+int qCRCx_SetAccel( qCRC_Engine_t * const e,
+                    const uint8_t enable )
+{
+    int retValue = 0;
+
+    if ( ( NULL != e ) && ( 32u == e->width ) ) {
+        e->accel = 0u;
+        #if defined( QCRC_ACCEL )
+        if ( 0u != enable ) {
+            e->accel = qCRCx_AccelSelect( e->poly, e->refIn, e->fold );
+        }
+        #endif
+        retValue = ( ( 0u == enable ) || ( 0u != e->accel ) )? 1 : 0;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static uint32_t qCRCx_SliceUpdate( const qCRC_Engine_t * const e,
+                                   uint32_t crc,
+                                   const uint8_t * msg,
+                                   size_t * const length )
+{
+    const uint32_t * const t = e->slice;
+    size_t n = *length;
+    uint32_t one, two, three, four;
+
+    if ( 0u != e->refIn ) {
+        while ( ( 16u == e->nSlices ) && ( n >= 16u ) ) {
+            one = crc ^ ( (uint32_t)msg[ 0 ] | ( (uint32_t)msg[ 1 ] << 8u ) |
+                  ( (uint32_t)msg[ 2 ] << 16u ) | ( (uint32_t)msg[ 3 ] << 24u ) );
+            two = (uint32_t)msg[ 4 ] | ( (uint32_t)msg[ 5 ] << 8u ) |
+                  ( (uint32_t)msg[ 6 ] << 16u ) | ( (uint32_t)msg[ 7 ] << 24u );
+            three = (uint32_t)msg[ 8 ] | ( (uint32_t)msg[ 9 ] << 8u ) |
+                    ( (uint32_t)msg[ 10 ] << 16u ) | ( (uint32_t)msg[ 11 ] << 24u );
+            four = (uint32_t)msg[ 12 ] | ( (uint32_t)msg[ 13 ] << 8u ) |
+                   ( (uint32_t)msg[ 14 ] << 16u ) | ( (uint32_t)msg[ 15 ] << 24u );
+            crc = t[ 3840u + ( one & 0xFFu ) ] ^
+                  t[ 3584u + ( ( one >> 8u ) & 0xFFu ) ] ^
+                  t[ 3328u + ( ( one >> 16u ) & 0xFFu ) ] ^
+                  t[ 3072u + ( one >> 24u ) ] ^
+                  t[ 2816u + ( two & 0xFFu ) ] ^
+                  t[ 2560u + ( ( two >> 8u ) & 0xFFu ) ] ^
+                  t[ 2304u + ( ( two >> 16u ) & 0xFFu ) ] ^
+                  t[ 2048u + ( two >> 24u ) ] ^
+                  t[ 1792u + ( three & 0xFFu ) ] ^
+                  t[ 1536u + ( ( three >> 8u ) & 0xFFu ) ] ^
+                  t[ 1280u + ( ( three >> 16u ) & 0xFFu ) ] ^
+                  t[ 1024u + ( three >> 24u ) ] ^
+                  t[ 768u + ( four & 0xFFu ) ] ^
+                  t[ 512u + ( ( four >> 8u ) & 0xFFu ) ] ^
+                  t[ 256u + ( ( four >> 16u ) & 0xFFu ) ] ^
+                  t[ four >> 24u ];
+            msg += 16;
+            n -= 16u;
+        }
+        while ( n >= 8u ) {
+            one = crc ^ ( (uint32_t)msg[ 0 ] | ( (uint32_t)msg[ 1 ] << 8u ) |
+                  ( (uint32_t)msg[ 2 ] << 16u ) | ( (uint32_t)msg[ 3 ] << 24u ) );
+            two = (uint32_t)msg[ 4 ] | ( (uint32_t)msg[ 5 ] << 8u ) |
+                  ( (uint32_t)msg[ 6 ] << 16u ) | ( (uint32_t)msg[ 7 ] << 24u );
+            crc = t[ 1792u + ( one & 0xFFu ) ] ^
+                  t[ 1536u + ( ( one >> 8u ) & 0xFFu ) ] ^
+                  t[ 1280u + ( ( one >> 16u ) & 0xFFu ) ] ^
+                  t[ 1024u + ( one >> 24u ) ] ^
+                  t[ 768u + ( two & 0xFFu ) ] ^
+                  t[ 512u + ( ( two >> 8u ) & 0xFFu ) ] ^
+                  t[ 256u + ( ( two >> 16u ) & 0xFFu ) ] ^
+                  t[ two >> 24u ];
+            msg += 8;
+            n -= 8u;
+        }
+    }
+    else {
+        while ( ( 16u == e->nSlices ) && ( n >= 16u ) ) {
+            one = crc ^ ( ( (uint32_t)msg[ 0 ] << 24u ) | ( (uint32_t)msg[ 1 ] << 16u ) |
+                  ( (uint32_t)msg[ 2 ] << 8u ) | (uint32_t)msg[ 3 ] );
+            crc = t[ 3840u + ( one >> 24u ) ] ^
+                  t[ 3584u + ( ( one >> 16u ) & 0xFFu ) ] ^
+                  t[ 3328u + ( ( one >> 8u ) & 0xFFu ) ] ^
+                  t[ 3072u + ( one & 0xFFu ) ] ^
+                  t[ 2816u + (uint32_t)msg[ 4 ] ] ^
+                  t[ 2560u + (uint32_t)msg[ 5 ] ] ^
+                  t[ 2304u + (uint32_t)msg[ 6 ] ] ^
+                  t[ 2048u + (uint32_t)msg[ 7 ] ] ^
+                  t[ 1792u + (uint32_t)msg[ 8 ] ] ^
+                  t[ 1536u + (uint32_t)msg[ 9 ] ] ^
+                  t[ 1280u + (uint32_t)msg[ 10 ] ] ^
+                  t[ 1024u + (uint32_t)msg[ 11 ] ] ^
+                  t[ 768u + (uint32_t)msg[ 12 ] ] ^
+                  t[ 512u + (uint32_t)msg[ 13 ] ] ^
+                  t[ 256u + (uint32_t)msg[ 14 ] ] ^
+                  t[ (uint32_t)msg[ 15 ] ];
+            msg += 16;
+            n -= 16u;
+        }
+        while ( n >= 8u ) {
+            one = crc ^ ( ( (uint32_t)msg[ 0 ] << 24u ) | ( (uint32_t)msg[ 1 ] << 16u ) |
+                  ( (uint32_t)msg[ 2 ] << 8u ) | (uint32_t)msg[ 3 ] );
+            crc = t[ 1792u + ( one >> 24u ) ] ^
+                  t[ 1536u + ( ( one >> 16u ) & 0xFFu ) ] ^
+                  t[ 1280u + ( ( one >> 8u ) & 0xFFu ) ] ^
+                  t[ 1024u + ( one & 0xFFu ) ] ^
+                  t[ 768u + (uint32_t)msg[ 4 ] ] ^
+                  t[ 512u + (uint32_t)msg[ 5 ] ] ^
+                  t[ 256u + (uint32_t)msg[ 6 ] ] ^
+                  t[ (uint32_t)msg[ 7 ] ];
+            msg += 8;
+            n -= 8u;
+        }
+    }
+    *length = n;
+
+    return crc;
+}
+/*============================================================================*/
+static uint32_t qCRCx_TableUpdate( const qCRC_Engine_t * const e,
+                                   uint32_t crc,
+                                   const uint8_t * const msg,
+                                   const size_t length )
+{
+    size_t i;
+
+    if ( 0u != e->refIn ) {
+        for ( i = 0u ; i < length ; ++i ) {
+            crc = e->table[ ( crc ^ (uint32_t)msg[ i ] ) & 0xFFu ] ^ ( crc >> 8u );
+        }
+    }
+    else {
+        const uint32_t wd1 = (uint32_t)e->width - 8u;
+        /*bits above the CRC width are discarded when the result is masked*/
+        for ( i = 0u ; i < length ; ++i ) {
+            /*cstat -CERT-INT34-C_a*/
+            crc = e->table[ ( ( crc >> wd1 ) ^ (uint32_t)msg[ i ] ) & 0xFFu ] ^ ( crc << 8u );
+            /*cstat +CERT-INT34-C_a*/
+        }
+    }
+
+    return crc & e->bitMask;
+}
+/*============================================================================*/
+static uint32_t qCRCx_EngineUpdate( const qCRC_Engine_t * const e,
+                                    uint32_t crc,
+                                    const uint8_t * const msg,
+                                    const size_t length )
+{
+    size_t n = length;
+
+    #if defined( QCRC_ACCEL )
+    if ( ( QCRC_ACCEL_NONE != e->accel ) && ( length >= QCRC_ACCEL_MIN_LENGTH ) ) {
+        uint8_t folded[ 16 ];
+
+        n = length - qCRCx_AccelUpdate( e->accel, e->fold, e->refIn, &crc, msg, length, folded );
+        if ( QCRC_ACCEL_CLMUL == e->accel ) {
+            crc = qCRCx_TableUpdate( e, crc, folded, sizeof(folded) );
+        }
+    }
+    #endif
+    /*slicing only pays off for buffers longer than one iteration*/
+    if ( ( NULL != e->slice ) && ( n >= 16u ) ) {
+        crc = qCRCx_SliceUpdate( e, crc, &msg[ length - n ], &n );
+    }
+
+    return qCRCx_TableUpdate( e, crc, &msg[ length - n ], n );
+}
+/*============================================================================*/
+static uint32_t qCRCx_EngineFinal( const qCRC_Engine_t * const e,
+                                   uint32_t crc )
+{
+    if ( 0u != e->refSwap ) {
+        crc = qCRCx_Reflect( crc, e->width );
+    }
+
+    return ( crc ^ e->xorOut ) & e->bitMask;
+}
+/*============================================================================*/
+uint32_t qCRCx_Compute( const qCRC_Engine_t * const e,
+                        const void * const pData,
+                        const size_t length )
+{
+    uint32_t crc = 0uL;
+
+    if ( ( NULL != e ) && ( NULL != pData ) && ( length > 0u ) ) {
+        /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+        uint8_t const * const msg = pData;
+        /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+        crc = qCRCx_EngineUpdate( e, e->init, msg, length );
+        crc = qCRCx_EngineFinal( e, crc );
+    }
+
+    return crc;
+}
+/*============================================================================*/
+int qCRCx_Init( qCRC_State_t * const s,
+                const qCRC_Engine_t * const e )
+{
+    int retValue = 0;
+
+    if ( ( NULL != s ) && ( NULL != e ) ) {
+        s->e = e;
+        s->crc = e->init;
+        retValue = 1;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+int qCRCx_Update( qCRC_State_t * const s,
+                  const void * const pData,
+                  const size_t length )
+{
+    int retValue = 0;
+
+    if ( ( NULL != s ) && ( NULL != s->e ) && ( ( NULL != pData ) || ( 0u == length ) ) ) {
+        if ( length > 0u ) {
+            /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+            uint8_t const * const msg = pData;
+            /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+            s->crc = qCRCx_EngineUpdate( s->e, s->crc, msg, length );
+        }
+        retValue = 1;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+uint32_t qCRCx_Final( const qCRC_State_t * const s )
+{
+    uint32_t crc = 0uL;
+
+    if ( ( NULL != s ) && ( NULL != s->e ) ) {
+        crc = qCRCx_EngineFinal( s->e, s->crc );
+    }
+
+    return crc;
+}
+/*============================================================================*/
+static uint32_t qCRCx_MatrixTimes( const uint32_t * const mat,
+                                   uint32_t vec )
+{
+    uint32_t sum = 0uL;
+    size_t i = 0u;
+
+    while ( 0u != vec ) {
+        if ( 0u != ( vec & 1u ) ) {
+            sum ^= mat[ i ];
+        }
+        vec >>= 1u;
+        ++i;
+    }
+
+    return sum;
+}
+/*============================================================================*/
+static void qCRCx_MatrixSquare( uint32_t * const square,
+                                const uint32_t * const mat,
+                                const uint8_t width )
+{
+    size_t i;
+
+    for ( i = 0u ; i < width ; ++i ) {
+        square[ i ] = qCRCx_MatrixTimes( mat, mat[ i ] );
+    }
+}
+/*============================================================================*/
+uint32_t qCRCx_Combine( const uint32_t crcA,
+                        const uint32_t crcB,
+                        size_t lenB,
+                        const qCRC_Engine_t * const e )
+{
+    uint32_t crc = crcA;
+
+    if ( ( NULL != e ) && ( lenB > 0u ) ) {
+        uint32_t odd[ 32 ], even[ 32 ];
+        uint32_t *op = odd, *sq = even, *tmp;
+        uint32_t a, b;
+        const uint8_t refOut = e->refIn ^ e->refSwap;
+        size_t i;
+        /*the combination is done with the register in normal form:
+        reg(A|B) = Z^lenB*( reg(A) ^ init ) ^ reg(B), where Z is the operator
+        that feeds one zero byte into the register*/
+        a = ( crcA ^ e->xorOut ) & e->bitMask;
+        b = ( crcB ^ e->xorOut ) & e->bitMask;
+        if ( 0u != refOut ) {
+            a = qCRCx_Reflect( a, e->width );
+            b = qCRCx_Reflect( b, e->width );
+        }
+        a ^= ( 0u != e->refIn )? qCRCx_Reflect( e->init, e->width ) : e->init;
+        /*operator for one zero bit*/
+        for ( i = 0u ; i < ( (size_t)e->width - 1u ) ; ++i ) {
+            /*cstat -CERT-INT34-C_a*/
+            op[ i ] = 1uL << ( i + 1u );
+            /*cstat +CERT-INT34-C_a*/
+        }
+        op[ e->width - 1u ] = e->poly;
+        /*square it three times to get the operator for one zero byte*/
+        for ( i = 0u ; i < 3u ; ++i ) {
+            qCRCx_MatrixSquare( sq, op, e->width );
+            tmp = op;
+            op = sq;
+            sq = tmp;
+        }
+        /*apply Z^lenB by square-and-multiply*/
+        while ( 0u != lenB ) {
+            if ( 0u != ( lenB & 1u ) ) {
+                a = qCRCx_MatrixTimes( op, a );
+            }
+            lenB >>= 1u;
+            if ( 0u != lenB ) {
+                qCRCx_MatrixSquare( sq, op, e->width );
+                tmp = op;
+                op = sq;
+                sq = tmp;
+            }
+        }
+        crc = ( a ^ b ) & e->bitMask;
+        if ( 0u != refOut ) {
+            crc = qCRCx_Reflect( crc, e->width );
+        }
+        crc = ( crc ^ e->xorOut ) & e->bitMask;
+    }
+
+    return crc;
+}
+/*============================================================================*/
+static size_t qCRCx_BatchNext( const void * const bufs[],
+                               const size_t lens[],
+                               uint32_t out[],
+                               size_t next,
+                               const size_t n )
+{
+    /*empty messages are resolved immediately*/
+    while ( ( next < n ) && ( ( NULL == bufs[ next ] ) || ( 0u == lens[ next ] ) ) ) {
+        out[ next ] = 0uL;
+        ++next;
+    }
+
+    return next;
+}
+/*============================================================================*/
+int qCRCx_Batch( const qCRC_Engine_t * const e,
+                 const void * const bufs[],
+                 const size_t lens[],
+                 uint32_t out[],
+                 const size_t n )
+{
+    int retValue = 0;
+
+    if ( ( NULL != e ) && ( NULL != bufs ) && ( NULL != lens ) && ( NULL != out ) ) {
+        struct {
+            const uint8_t *m;   /*-> remaining data of the message*/
+            size_t rem;         /*-> remaining bytes of the message*/
+            size_t idx;         /*-> message index in the batch*/
+            uint32_t c;         /*-> running register*/
+        } lane[ 4 ];
+        const uint32_t * const t = e->table;
+        const uint32_t wd1 = (uint32_t)e->width - 8u;
+        uint32_t c0, c1, c2, c3;
+        const uint8_t *m0, *m1, *m2, *m3;
+        size_t next = 0u, active = 0u, j, k, step;
+
+        /*each lane holds one message, when it ends the lane takes the next
+        one from the batch, so the four chains are kept busy*/
+        for ( k = 0u ; k < 4u ; ++k ) {
+            lane[ k ].m = NULL;
+            next = qCRCx_BatchNext( bufs, lens, out, next, n );
+            if ( next < n ) {
+                /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+                lane[ k ].m = bufs[ next ];
+                /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+                lane[ k ].rem = lens[ next ];
+                lane[ k ].idx = next;
+                lane[ k ].c = e->init;
+                ++next;
+                ++active;
+            }
+        }
+        while ( 4u == active ) {
+            step = lane[ 0 ].rem;
+            for ( k = 1u ; k < 4u ; ++k ) {
+                step = ( lane[ k ].rem < step )? lane[ k ].rem : step;
+            }
+            /*four independent dependency chains kept in locals*/
+            c0 = lane[ 0 ].c;
+            c1 = lane[ 1 ].c;
+            c2 = lane[ 2 ].c;
+            c3 = lane[ 3 ].c;
+            m0 = lane[ 0 ].m;
+            m1 = lane[ 1 ].m;
+            m2 = lane[ 2 ].m;
+            m3 = lane[ 3 ].m;
+            if ( 0u != e->refIn ) {
+                for ( j = 0u ; j < step ; ++j ) {
+                    c0 = t[ ( c0 ^ (uint32_t)m0[ j ] ) & 0xFFu ] ^ ( c0 >> 8u );
+                    c1 = t[ ( c1 ^ (uint32_t)m1[ j ] ) & 0xFFu ] ^ ( c1 >> 8u );
+                    c2 = t[ ( c2 ^ (uint32_t)m2[ j ] ) & 0xFFu ] ^ ( c2 >> 8u );
+                    c3 = t[ ( c3 ^ (uint32_t)m3[ j ] ) & 0xFFu ] ^ ( c3 >> 8u );
+                }
+            }
+            else {
+                for ( j = 0u ; j < step ; ++j ) {
+                    /*cstat -CERT-INT34-C_a*/
+                    c0 = t[ ( ( c0 >> wd1 ) ^ (uint32_t)m0[ j ] ) & 0xFFu ] ^ ( c0 << 8u );
+                    c1 = t[ ( ( c1 >> wd1 ) ^ (uint32_t)m1[ j ] ) & 0xFFu ] ^ ( c1 << 8u );
+                    c2 = t[ ( ( c2 >> wd1 ) ^ (uint32_t)m2[ j ] ) & 0xFFu ] ^ ( c2 << 8u );
+                    c3 = t[ ( ( c3 >> wd1 ) ^ (uint32_t)m3[ j ] ) & 0xFFu ] ^ ( c3 << 8u );
+                    /*cstat +CERT-INT34-C_a*/
+                }
+            }
+            lane[ 0 ].c = c0;
+            lane[ 1 ].c = c1;
+            lane[ 2 ].c = c2;
+            lane[ 3 ].c = c3;
+            for ( k = 0u ; k < 4u ; ++k ) {
+                lane[ k ].m = &lane[ k ].m[ step ];
+                lane[ k ].rem -= step;
+                if ( 0u == lane[ k ].rem ) {
+                    out[ lane[ k ].idx ] = qCRCx_EngineFinal( e, lane[ k ].c & e->bitMask );
+                    next = qCRCx_BatchNext( bufs, lens, out, next, n );
+                    if ( next < n ) {
+                        /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+                        lane[ k ].m = bufs[ next ];
+                        /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+                        lane[ k ].rem = lens[ next ];
+                        lane[ k ].idx = next;
+                        lane[ k ].c = e->init;
+                        ++next;
+                    }
+                    else {
+                        lane[ k ].m = NULL;
+                        --active;
+                    }
+                }
+            }
+        }
+        /*drain the lanes that are still busy*/
+        for ( k = 0u ; k < 4u ; ++k ) {
+            if ( NULL != lane[ k ].m ) {
+                c0 = qCRCx_EngineUpdate( e, lane[ k ].c & e->bitMask, lane[ k ].m, lane[ k ].rem );
+                out[ lane[ k ].idx ] = qCRCx_EngineFinal( e, c0 );
+            }
+        }
+        retValue = 1;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static uint64_t qCRCn_Reflect( uint64_t xData,
+                               const uint8_t nBits )
+{
+    uint64_t r = 0uLL;
+    uint8_t xBit;
+
+    for ( xBit = 0u ; xBit < nBits ; ++xBit ) {
+        r = ( r << 1u ) | ( xData & 1uLL );
+        xData >>= 1u;
+    }
+
+    return r;
+}
+/*============================================================================*/
+uint64_t qCRCn( const uint8_t width,
+                const void * const pData,
+                const size_t length,
+                uint64_t poly,
+                const uint64_t init,
+                const uint8_t refIn,
+                const uint8_t refOut,
+                uint64_t xorOut )
+{
+    uint64_t crc = 0uLL;
+
+    if ( ( NULL != pData ) && ( length > 0u ) && ( width >= 3u ) && ( width <= 64u ) ) {
+        size_t i;
+        uint8_t xBit, bit;
+        /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+        uint8_t const * const msg = pData;
+        /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+        const uint64_t bitMask = 0xFFFFFFFFFFFFFFFFuLL >> ( 64u - width );
+        /*cstat -MISRAC2012-Rule-10.8*/
+        const uint8_t top = (uint8_t)( width - 1u );
+        /*cstat +MISRAC2012-Rule-10.8*/
+
+        poly &= bitMask;
+        xorOut &= bitMask;
+        crc = init & bitMask;
+        /*Perform modulo-2 division, a bit at a time, so widths below 8 bits
+        need no special handling*/
+        for ( i = 0u ; i < length ; ++i ) {
+            for ( xBit = 0u ; xBit < 8u ; ++xBit ) {
+                bit = ( 0u != refIn )? ( ( msg[ i ] >> xBit ) & 1u )
+                                     : ( ( msg[ i ] >> ( 7u - xBit ) ) & 1u );
+                bit ^= (uint8_t)( ( crc >> top ) & 1uLL );
+                crc = ( crc << 1u ) & bitMask;
+                if ( 0u != bit ) {
+                    crc ^= poly;
+                }
+            }
+        }
+        crc = ( 0u != refOut )? qCRCn_Reflect( crc, width ) : crc;
+        crc = ( crc ^ xorOut ) & bitMask;
+    }
+
+    return crc;
+}
+/*============================================================================*/
+int qCRCn_Setup( qCRCn_Engine_t * const e,
+                 const uint8_t width,
+                 uint64_t poly,
+                 const uint64_t init,
+                 const uint8_t refIn,
+                 const uint8_t refOut,
+                 const uint64_t xorOut )
+{
+    int retValue = 0;
+
+    if ( ( NULL != e ) && ( width >= 3u ) && ( width <= 64u ) ) {
+        uint64_t crc;
+        uint32_t i;
+        uint8_t xBit;
+        const uint64_t bitMask = 0xFFFFFFFFFFFFFFFFuLL >> ( 64u - width );
+
+        poly &= bitMask;
+        e->width = width;
+        e->xorOut = xorOut & bitMask;
+        e->refIn = ( 0u != refIn )? 1u : 0u;
+        e->refSwap = ( ( 0u != refIn ) != ( 0u != refOut ) )? 1u : 0u;
+        if ( 0u != e->refIn ) {
+            /*natively reflected table: the data bytes are XORed into the low
+            bits of the register, which also works for widths below 8 bits*/
+            const uint64_t rpoly = qCRCn_Reflect( poly, width );
+            e->shift = 0u;
+            e->bitMask = bitMask;
+            e->init = qCRCn_Reflect( init & bitMask, width );
+            for ( i = 0u ; i < 256u ; ++i ) {
+                crc = i;
+                for ( xBit = 8u ; xBit > 0u ; --xBit ) {
+                    crc = ( 0u != ( crc & 1uLL ) )? ( ( crc >> 1u ) ^ rpoly )
+                                                  : ( crc >> 1u );
+                }
+                e->table[ i ] = crc;
+            }
+        }
+        else {
+            /*widths below 8 bits run left-aligned in an 8-bit register*/
+            const uint8_t shift = ( width < 8u )? ( 8u - width ) : 0u;
+            const uint8_t rw = width + shift;
+            const uint64_t topbit = 1uLL << ( rw - 1u );
+            const uint64_t rpoly = poly << shift;
+
+            e->shift = shift;
+            e->bitMask = bitMask << shift;
+            e->init = ( init & bitMask ) << shift;
+            for ( i = 0u ; i < 256u ; ++i ) {
+                crc = (uint64_t)i << ( rw - 8u );
+                for ( xBit = 8u ; xBit > 0u ; --xBit ) {
+                    crc = ( 0u != ( crc & topbit ) )? ( ( crc << 1u ) ^ rpoly )
+                                                    : ( crc << 1u );
+                }
+                e->table[ i ] = crc & e->bitMask;
+            }
+        }
+        retValue = 1;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static uint64_t qCRCn_TableUpdate( const qCRCn_Engine_t * const e,
+                                   uint64_t crc,
+                                   const uint8_t * const msg,
+                                   const size_t length )
+{
+    size_t i;
+
+    if ( 0u != e->refIn ) {
+        for ( i = 0u ; i < length ; ++i ) {
+            crc = e->table[ ( crc ^ (uint64_t)msg[ i ] ) & 0xFFu ] ^ ( crc >> 8u );
+        }
+    }
+    else {
+        /*cstat -MISRAC2012-Rule-10.8*/
+        const uint8_t wd1 = (uint8_t)( ( e->width + e->shift ) - 8u );
+        /*cstat +MISRAC2012-Rule-10.8*/
+
+        for ( i = 0u ; i < length ; ++i ) {
+            crc = e->table[ ( ( crc >> wd1 ) ^ (uint64_t)msg[ i ] ) & 0xFFu ] ^ ( crc << 8u );
+        }
+    }
+
+    return crc & e->bitMask;
+}
+/*============================================================================*/
+static uint64_t qCRCn_EngineFinal( const qCRCn_Engine_t * const e,
+                                   uint64_t crc )
+{
+    crc >>= e->shift;
+    if ( 0u != e->refSwap ) {
+        crc = qCRCn_Reflect( crc, e->width );
+    }
+
+    return ( crc ^ e->xorOut ) & ( e->bitMask >> e->shift );
+}
+/*============================================================================*/
+uint64_t qCRCn_Compute( const qCRCn_Engine_t * const e,
+                        const void * const pData,
+                        const size_t length )
+{
+    uint64_t crc = 0uLL;
+
+    if ( ( NULL != e ) && ( NULL != pData ) && ( length > 0u ) ) {
+        /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+        uint8_t const * const msg = pData;
+        /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+        crc = qCRCn_TableUpdate( e, e->init, msg, length );
+        crc = qCRCn_EngineFinal( e, crc );
+    }
+
+    return crc;
+}
+/*============================================================================*/
+int qCRCn_Init( qCRCn_State_t * const s,
+                const qCRCn_Engine_t * const e )
+{
+    int retValue = 0;
+
+    if ( ( NULL != s ) && ( NULL != e ) ) {
+        s->e = e;
+        s->crc = e->init;
+        retValue = 1;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+int qCRCn_Update( qCRCn_State_t * const s,
+                  const void * const pData,
+                  const size_t length )
+{
+    int retValue = 0;
+
+    if ( ( NULL != s ) && ( NULL != s->e ) && ( ( NULL != pData ) || ( 0u == length ) ) ) {
+        if ( length > 0u ) {
+            /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+            uint8_t const * const msg = pData;
+            /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+            s->crc = qCRCn_TableUpdate( s->e, s->crc, msg, length );
+        }
+        retValue = 1;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+uint64_t qCRCn_Final( const qCRCn_State_t * const s )
+{
+    uint64_t crc = 0uLL;
+
+    if ( ( NULL != s ) && ( NULL != s->e ) ) {
+        crc = qCRCn_EngineFinal( s->e, s->crc );
+    }
+
+    return crc;
+}
+/*============================================================================*/
+#if defined( QCRC_ACCEL )
+static uint8_t qCRCx_AccelFeatures( void )
+{
+    uint8_t features = QCRC_ACCEL_NONE;
+
+    #if defined( QCRC_ACCEL_X86 )
+        if ( 0 != __builtin_cpu_supports( "sse4.2" ) ) {
+            features |= QCRC_ACCEL_CRC32C;
+        }
+        if ( ( 0 != __builtin_cpu_supports( "pclmul" ) ) &&
+             ( 0 != __builtin_cpu_supports( "sse4.1" ) ) ) {
+            features |= QCRC_ACCEL_CLMUL;
+        }
+    #else
+        /*on AArch64 the features are enabled at compile time*/
+        #if defined( __ARM_FEATURE_CRC32 )
+            features |= QCRC_ACCEL_CRC32C;
+        #endif
+        features |= QCRC_ACCEL_CLMUL;
+    #endif
+
+    return features;
+}
+/*============================================================================*/
+static uint8_t qCRCx_AccelSelect( const uint32_t poly,
+                                  const uint8_t refIn,
+                                  uint64_t * const k )
+{
+    uint8_t accel = QCRC_ACCEL_NONE;
+    const uint8_t features = qCRCx_AccelFeatures();
+
+    if ( ( 0u != refIn ) && ( QCRC_POLY_CASTAGNOLI == poly ) &&
+         ( 0u != ( features & QCRC_ACCEL_CRC32C ) ) ) {
+        accel = QCRC_ACCEL_CRC32C;
+    }
+    else if ( 0u != ( features & QCRC_ACCEL_CLMUL ) ) {
+        /*exponents of the folding constants x^n mod P, in ascending order.
+        Fold distances are 128 bits ( one block ) and 512 bits ( four blocks )*/
+        const uint32_t nr[ 4 ] = { 96u, 160u, 480u, 544u };
+        const uint32_t nn[ 4 ] = { 128u, 192u, 512u, 576u };
+        const uint32_t * const xn = ( 0u != refIn )? nr : nn;
+        uint32_t r = 1uL, j = 0u;
+        size_t i;
+
+        for ( i = 0u ; i < 4u ; ++i ) {
+            for ( ; j < xn[ i ] ; ++j ) {
+                r = ( 0u != ( r & 0x80000000uL ) )? ( ( r << 1u ) ^ poly )
+                                                  : ( r << 1u );
+            }
+            /*reflected constants are shifted to keep the product aligned*/
+            k[ i ] = ( 0u != refIn )? ( (uint64_t)qCRCx_Reflect( r, 32u ) << 1u )
+                                    : (uint64_t)r;
+        }
+        /*for reflected data, the low qword holds the higher degree terms*/
+        if ( 0u != refIn ) {
+            uint64_t tmp = k[ 0 ];
+            k[ 0 ] = k[ 1 ];
+            k[ 1 ] = tmp;
+            tmp = k[ 2 ];
+            k[ 2 ] = k[ 3 ];
+            k[ 3 ] = tmp;
+        }
+        accel = QCRC_ACCEL_CLMUL;
+    }
+    else {
+        /*keep the portable path*/
+    }
+
+    return accel;
+}
+/*============================================================================*/
+static size_t qCRCx_AccelUpdate( const uint8_t accel,
+                                 const uint64_t * const k,
+                                 const uint8_t refIn,
+                                 uint32_t * const crc,
+                                 const uint8_t * const msg,
+                                 const size_t length,
+                                 uint8_t * const folded )
+{
+    size_t used = 0u;
+
+    if ( QCRC_ACCEL_CRC32C == accel ) {
+        *crc = qCRCx_CRC32C( *crc, msg, length );
+        used = length;
+    }
+    else if ( ( QCRC_ACCEL_CLMUL == accel ) && ( length >= 64u ) ) {
+        /*the message is folded into 16 bytes congruent modulo P, that must be
+        processed by the caller starting from a zero register*/
+        used = qCRCx_FoldCLMUL( k, refIn, *crc, msg, length, folded );
+        *crc = 0uL;
+    }
+    else {
+        /*nothing to do*/
+    }
+
+    return used;
+}
+/*============================================================================*/
+#if defined( QCRC_ACCEL_X86 )
+__attribute__(( target( "sse4.2" ) ))
+static uint32_t qCRCx_CRC32C( uint32_t crc,
+                              const uint8_t *msg,
+                              size_t length )
+{
+    #if defined( __x86_64__ )
+        uint64_t c = crc, v;
+
+        while ( length >= 8u ) {
+            (void)memcpy( &v, msg, sizeof(v) );
+            c = _mm_crc32_u64( c, v );
+            msg += 8;
+            length -= 8u;
+        }
+        crc = (uint32_t)c;
+    #else
+        uint32_t v;
+
+        while ( length >= 4u ) {
+            (void)memcpy( &v, msg, sizeof(v) );
+            crc = _mm_crc32_u32( crc, v );
+            msg += 4;
+            length -= 4u;
+        }
+    #endif
+    while ( length > 0u ) {
+        crc = _mm_crc32_u8( crc, *msg );
+        ++msg;
+        --length;
+    }
+
+    return crc;
+}
+/*============================================================================*/
+__attribute__(( target( "pclmul,sse4.1" ) ))
+static size_t qCRCx_FoldCLMUL( const uint64_t * const k,
+                               const uint8_t refIn,
+                               const uint32_t crc,
+                               const uint8_t * const msg,
+                               const size_t length,
+                               uint8_t * const folded )
+{
+    const __m128i swap = _mm_set_epi8( 0, 1, 2, 3, 4, 5, 6, 7,
+                                       8, 9, 10, 11, 12, 13, 14, 15 );
+    /*cstat -MISRAC2012-Rule-10.8*/
+    const __m128i k1 = _mm_set_epi64x( (long long)k[ 1 ], (long long)k[ 0 ] );
+    const __m128i k4 = _mm_set_epi64x( (long long)k[ 3 ], (long long)k[ 2 ] );
+    /*cstat +MISRAC2012-Rule-10.8*/
+    __m128i x[ 4 ], y;
+    size_t i, n;
+
+    for ( i = 0u ; i < 4u ; ++i ) {
+        x[ i ] = _mm_loadu_si128( (const __m128i*)&msg[ 16u*i ] );
+        if ( 0u == refIn ) {
+            x[ i ] = _mm_shuffle_epi8( x[ i ], swap );
+        }
+    }
+    /*absorb the initial register into the first four bytes*/
+    /*cstat -MISRAC2012-Rule-10.8*/
+    x[ 0 ] = _mm_xor_si128( x[ 0 ], ( 0u != refIn )? _mm_cvtsi32_si128( (int)crc )
+                                                     : _mm_set_epi32( (int)crc, 0, 0, 0 ) );
+    /*cstat +MISRAC2012-Rule-10.8*/
+    /*fold by four blocks*/
+    for ( n = 64u ; ( length - n ) >= 64u ; n += 64u ) {
+        for ( i = 0u ; i < 4u ; ++i ) {
+            y = _mm_loadu_si128( (const __m128i*)&msg[ n + ( 16u*i ) ] );
+            if ( 0u == refIn ) {
+                y = _mm_shuffle_epi8( y, swap );
+            }
+            x[ i ] = _mm_xor_si128( _mm_xor_si128( y, _mm_clmulepi64_si128( x[ i ], k4, 0x00 ) ),
+                                    _mm_clmulepi64_si128( x[ i ], k4, 0x11 ) );
+        }
+    }
+    /*reduce the four accumulators to one and fold the remaining blocks*/
+    for ( i = 1u ; i < 4u ; ++i ) {
+        x[ 0 ] = _mm_xor_si128( _mm_xor_si128( x[ i ], _mm_clmulepi64_si128( x[ 0 ], k1, 0x00 ) ),
+                                _mm_clmulepi64_si128( x[ 0 ], k1, 0x11 ) );
+    }
+    for ( ; ( length - n ) >= 16u ; n += 16u ) {
+        y = _mm_loadu_si128( (const __m128i*)&msg[ n ] );
+        if ( 0u == refIn ) {
+            y = _mm_shuffle_epi8( y, swap );
+        }
+        x[ 0 ] = _mm_xor_si128( _mm_xor_si128( y, _mm_clmulepi64_si128( x[ 0 ], k1, 0x00 ) ),
+                                _mm_clmulepi64_si128( x[ 0 ], k1, 0x11 ) );
+    }
+    if ( 0u == refIn ) {
+        x[ 0 ] = _mm_shuffle_epi8( x[ 0 ], swap );
+    }
+    _mm_storeu_si128( (__m128i*)folded, x[ 0 ] );
+
+    return n;
+}
+#else
+/*============================================================================*/
+static uint32_t qCRCx_CRC32C( uint32_t crc,
+                              const uint8_t *msg,
+                              size_t length )
+{
+    #if defined( __ARM_FEATURE_CRC32 )
+        uint64_t v;
+
+        while ( length >= 8u ) {
+            (void)memcpy( &v, msg, sizeof(v) );
+            crc = __crc32cd( crc, v );
+            msg += 8;
+            length -= 8u;
+        }
+        while ( length > 0u ) {
+            crc = __crc32cb( crc, *msg );
+            ++msg;
+            --length;
+        }
+    #else
+        (void)msg;
+        (void)length;
+    #endif
+
+    return crc;
+}
+/*============================================================================*/
+static uint8x16_t qCRCx_FoldPMULL( const uint8x16_t x,
+                                   const uint8x16_t y,
+                                   const uint64_t * const k )
+{
+    const uint64x2_t v = vreinterpretq_u64_u8( x );
+    const uint64x2_t lo = vreinterpretq_u64_p128( vmull_p64( (poly64_t)vgetq_lane_u64( v, 0 ), (poly64_t)k[ 0 ] ) );
+    const uint64x2_t hi = vreinterpretq_u64_p128( vmull_p64( (poly64_t)vgetq_lane_u64( v, 1 ), (poly64_t)k[ 1 ] ) );
+
+    return veorq_u8( y, vreinterpretq_u8_u64( veorq_u64( lo, hi ) ) );
+}
+/*============================================================================*/
+static uint8x16_t qCRCx_LoadPMULL( const uint8_t * const msg,
+                                   const uint8_t refIn )
+{
+    uint8x16_t y = vld1q_u8( msg );
+
+    if ( 0u == refIn ) {
+        y = vrev64q_u8( y );
+        y = vextq_u8( y, y, 8 );
+    }
+
+    return y;
+}
+/*============================================================================*/
+static size_t qCRCx_FoldCLMUL( const uint64_t * const k,
+                               const uint8_t refIn,
+                               const uint32_t crc,
+                               const uint8_t * const msg,
+                               const size_t length,
+                               uint8_t * const folded )
+{
+    uint8x16_t x[ 4 ];
+    size_t i, n;
+
+    for ( i = 0u ; i < 4u ; ++i ) {
+        x[ i ] = qCRCx_LoadPMULL( &msg[ 16u*i ], refIn );
+    }
+    /*absorb the initial register into the first four bytes*/
+    if ( 0u != refIn ) {
+        x[ 0 ] = veorq_u8( x[ 0 ], vreinterpretq_u8_u32( vsetq_lane_u32( crc, vdupq_n_u32( 0u ), 0 ) ) );
+    }
+    else {
+        x[ 0 ] = veorq_u8( x[ 0 ], vreinterpretq_u8_u32( vsetq_lane_u32( crc, vdupq_n_u32( 0u ), 3 ) ) );
+    }
+    /*fold by four blocks*/
+    for ( n = 64u ; ( length - n ) >= 64u ; n += 64u ) {
+        for ( i = 0u ; i < 4u ; ++i ) {
+            x[ i ] = qCRCx_FoldPMULL( x[ i ], qCRCx_LoadPMULL( &msg[ n + ( 16u*i ) ], refIn ), &k[ 2 ] );
+        }
+    }
+    /*reduce the four accumulators to one and fold the remaining blocks*/
+    for ( i = 1u ; i < 4u ; ++i ) {
+        x[ 0 ] = qCRCx_FoldPMULL( x[ 0 ], x[ i ], &k[ 0 ] );
+    }
+    for ( ; ( length - n ) >= 16u ; n += 16u ) {
+        x[ 0 ] = qCRCx_FoldPMULL( x[ 0 ], qCRCx_LoadPMULL( &msg[ n ], refIn ), &k[ 0 ] );
+    }
+    if ( 0u == refIn ) {
+        x[ 0 ] = vrev64q_u8( x[ 0 ] );
+        x[ 0 ] = vextq_u8( x[ 0 ], x[ 0 ], 8 );
+    }
+    vst1q_u8( folded, x[ 0 ] );
+
+    return n;
+}
+#endif
+/*============================================================================*/
+#endif
@@ -0,0 +1,196 @@
+/*!
+ * @file qcrcpar.c
+ * @author J. Camilo Gomez C.
+ * @note This file is part of the qTools distribution.
+ **/
+
+#ifndef _POSIX_C_SOURCE
+    #define _POSIX_C_SOURCE     200809L
+#endif
+
+#include "qcrcpar.h"
+#include <pthread.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define QCRC_PAR_READ_SIZE      ( 65536u )
+
+typedef struct
+{
+    const qCRC_Engine_t *e;
+    const uint8_t *data;
+    size_t length;
+    uint32_t crc;
+} qCRC_ParSegment_t;
+
+static void* qCRCx_ParWorker( void *arg );
+static size_t qCRCx_ParThreads( size_t nThreads );
+static int qCRCx_ReadFile( const qCRC_Engine_t * const e,
+                           const int fd,
+                           uint32_t * const crc );
+
+/*============================================================================*/
+static void* qCRCx_ParWorker( void *arg )
+{
+    /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+    qCRC_ParSegment_t * const seg = arg;
+    /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+    seg->crc = qCRCx_Compute( seg->e, seg->data, seg->length );
+
+    return NULL;
+}
+/*============================================================================*/
+static size_t qCRCx_ParThreads( size_t nThreads )
+{
+    if ( 0u == nThreads ) {
+        const long n = sysconf( _SC_NPROCESSORS_ONLN );
+        nThreads = ( n > 0 )? (size_t)n : 1u;
+    }
+    if ( nThreads > QCRC_PAR_MAX_THREADS ) {
+        nThreads = QCRC_PAR_MAX_THREADS;
+    }
+
+    return nThreads;
+}
+/*============================================================================*/
+uint32_t qCRCx_Parallel( const qCRC_Engine_t * const e,
+                         const void * const pData,
+                         const size_t length,
+                         size_t nThreads )
+{
+    uint32_t crc = 0uL;
+
+    if ( ( NULL != e ) && ( NULL != pData ) && ( length > 0u ) ) {
+        /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+        uint8_t const * const msg = pData;
+        /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+        const size_t nChunks = ( length + QCRC_PAR_CHUNK_SIZE - 1u )/QCRC_PAR_CHUNK_SIZE;
+
+        nThreads = qCRCx_ParThreads( nThreads );
+        if ( nThreads > nChunks ) {
+            nThreads = nChunks;
+        }
+        if ( nThreads <= 1u ) {
+            crc = qCRCx_Compute( e, msg, length );
+        }
+        else {
+            qCRC_ParSegment_t seg[ QCRC_PAR_MAX_THREADS ];
+            pthread_t tid[ QCRC_PAR_MAX_THREADS ];
+            uint8_t spawned[ QCRC_PAR_MAX_THREADS ];
+            const size_t perThread = nChunks/nThreads;
+            const size_t extra = nChunks % nThreads;
+            size_t i, offset = 0u;
+
+            /*contiguous segments of whole chunks, the first ones take one
+            more chunk each and only the last one ends at the partial chunk,
+            so no segment is longer than another by more than one chunk*/
+            for ( i = 0u ; i < nThreads ; ++i ) {
+                const size_t chunks = ( i < extra )? ( perThread + 1u ) : perThread;
+
+                seg[ i ].e = e;
+                seg[ i ].data = &msg[ offset ];
+                seg[ i ].length = ( i < ( nThreads - 1u ) )? ( chunks*QCRC_PAR_CHUNK_SIZE )
+                                                           : ( length - offset );
+                offset += seg[ i ].length;
+            }
+            /*the calling thread handles the last segment, the shortest one*/
+            for ( i = 0u ; i < ( nThreads - 1u ) ; ++i ) {
+                spawned[ i ] = ( 0 == pthread_create( &tid[ i ], NULL, &qCRCx_ParWorker, &seg[ i ] ) )? 1u : 0u;
+                if ( 0u == spawned[ i ] ) {
+                    (void)qCRCx_ParWorker( &seg[ i ] );
+                }
+            }
+            (void)qCRCx_ParWorker( &seg[ nThreads - 1u ] );
+            /*merge the partial results in order*/
+            for ( i = 0u ; i < nThreads ; ++i ) {
+                if ( ( i < ( nThreads - 1u ) ) && ( 0u != spawned[ i ] ) ) {
+                    (void)pthread_join( tid[ i ], NULL );
+                }
+                crc = ( 0u == i )? seg[ 0 ].crc
+                                 : qCRCx_Combine( crc, seg[ i ].crc, seg[ i ].length, e );
+            }
+        }
+    }
+    else if ( ( NULL != e ) && ( 0u == length ) ) {
+        /*the CRC of an empty message, as qCRCx_File() gives for an empty file*/
+        qCRC_State_t s;
+
+        (void)qCRCx_Init( &s, e );
+        crc = qCRCx_Final( &s );
+    }
+    else {
+        /*invalid arguments*/
+    }
+
+    return crc;
+}
+/*============================================================================*/
+static int qCRCx_ReadFile( const qCRC_Engine_t * const e,
+                           const int fd,
+                           uint32_t * const crc )
+{
+    int retValue = 1;
+    uint8_t buffer[ QCRC_PAR_READ_SIZE ];
+    qCRC_State_t s;
+    ssize_t n;
+
+    (void)qCRCx_Init( &s, e );
+    do {
+        n = read( fd, buffer, sizeof(buffer) );
+        if ( n > 0 ) {
+            (void)qCRCx_Update( &s, buffer, (size_t)n );
+        }
+        else if ( ( n < 0 ) && ( EINTR != errno ) ) {
+            retValue = 0;
+        }
+        else {
+            /*end of file, or interrupted by a signal before any data was
+            read, so try again*/
+        }
+    } while ( ( n > 0 ) || ( ( n < 0 ) && ( EINTR == errno ) ) );
+    *crc = qCRCx_Final( &s );
+
+    return retValue;
+}
+/*============================================================================*/
+int qCRCx_File( const qCRC_Engine_t * const e,
+                const char * const path,
+                const size_t nThreads,
+                uint32_t * const crc )
+{
+    int retValue = 0;
+
+    if ( ( NULL != e ) && ( NULL != path ) && ( NULL != crc ) ) {
+        const int fd = open( path, O_RDONLY );
+
+        if ( fd >= 0 ) {
+            struct stat st;
+
+            if ( ( 0 == fstat( fd, &st ) ) && S_ISREG( st.st_mode ) && ( st.st_size > 0 ) ) {
+                const size_t length = (size_t)st.st_size;
+                void *map = mmap( NULL, length, PROT_READ, MAP_PRIVATE, fd, 0 );
+
+                if ( MAP_FAILED != map ) {
+                    (void)posix_madvise( map, length, POSIX_MADV_SEQUENTIAL );
+                    *crc = qCRCx_Parallel( e, map, length, nThreads );
+                    (void)munmap( map, length );
+                    retValue = 1;
+                }
+                else {
+                    retValue = qCRCx_ReadFile( e, fd, crc );
+                }
+            }
+            else {
+                /*empty files, pipes and devices are read sequentially*/
+                retValue = qCRCx_ReadFile( e, fd, crc );
+            }
+            (void)close( fd );
+        }
+    }
+
+    return retValue;
+}
+/*============================================================================*/
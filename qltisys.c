@@ -5,11 +5,69 @@
  **/
 
 #include "qltisys.h"
+#include <string.h>
+#include <math.h>
+
+#if defined( QLTISYS_NO_SIMD )
+    #define QSIMD_DISABLE
+#endif
+#include "qsimd.h"
+
+#if defined( QSIMD )
+    #define QLTISYS_SIMD_MIN_LENGTH     ( 16u )
+#endif
 
 static float qLTISys_DiscreteUpdate( qLTISys_t * const sys,
                                      const float u );
 static float qLTISys_ContinuosUpdate( qLTISys_t * const sys,
                                       const float u );
+static float qLTISys_Dot( const float * const a,
+                          const float * const b,
+                          const size_t n );
+static float qLTISys_DotScalar( const float * const a,
+                                const float * const b,
+                                const size_t n );
+static float qLTISys_SymDot( const float * const c,
+                             const float * const a,
+                             const float * const b,
+                             const size_t n );
+static float qLTISys_Sum( const float * const a,
+                          const size_t n );
+static void qLTISys_FFT( float * const z,
+                         const float * const tw,
+                         const size_t nfft,
+                         const int inverse );
+static void qLTISys_RealFFT( float * const x,
+                             const float * const tw,
+                             const size_t nfft );
+static void qLTISys_RealIFFT( float * const x,
+                              const float * const tw,
+                              const size_t nfft );
+static void qLTISys_RingInsert( float * const w,
+                                const size_t wsize,
+                                size_t * const idx,
+                                const float * const x,
+                                const size_t n );
+static void qLTISys_FFTConv_Block( qLTISys_FFTConv_t * const e,
+                                   float * const y,
+                                   const size_t n );
+#if defined( QSIMD_X86 )
+static float qLTISys_HSumSSE2( const __m128 v );
+static float qLTISys_DotSSE2( const float * const a,
+                              const float * const b,
+                              const size_t n );
+static float qLTISys_DotAVX2( const float * const a,
+                              const float * const b,
+                              const size_t n );
+static float qLTISys_DotAVX512( const float * const a,
+                                const float * const b,
+                                const size_t n );
+#endif
+#if defined( QSIMD_ARM )
+static float qLTISys_DotNEON( const float * const a,
+                              const float * const b,
+                              const size_t n );
+#endif
 
 /*============================================================================*/
 static float qLTISys_DiscreteUpdate( qLTISys_t * const sys,
@@ -174,26 +232,538 @@ float qLTISys_DiscreteFIRUpdate( float *w,
                                  const float * const c,
                                  const size_t wsize,
                                  const float x )
+{
+    float y;
+
+    /*shift the window with a single block move, then evaluate*/
+    (void)memmove( &w[ 1 ], w, ( wsize - 1u )*sizeof(float) );
+    w[ 0 ] = x;
+    if ( NULL != c ) {
+        y = qLTISys_Dot( w, c, wsize );
+    }
+    else {
+        y = qLTISys_Sum( w, wsize );
+    }
+
+    return y;
+}
+/*============================================================================*/
+static float qLTISys_Dot( const float * const a,
+                          const float * const b,
+                          const size_t n )
+{
+    float y;
+
+    #if defined( QSIMD_X86 )
+    const uint8_t simd = ( n >= QLTISYS_SIMD_MIN_LENGTH )? qSIMD_Select()
+                                                         : QSIMD_NONE;
+    if ( QSIMD_AVX512 == simd ) {
+        y = qLTISys_DotAVX512( a, b, n );
+    }
+    else if ( QSIMD_AVX2 == simd ) {
+        y = qLTISys_DotAVX2( a, b, n );
+    }
+    else if ( QSIMD_SSE2 == simd ) {
+        y = qLTISys_DotSSE2( a, b, n );
+    }
+    else {
+        y = qLTISys_DotScalar( a, b, n );
+    }
+    #elif defined( QSIMD_ARM )
+    if ( ( n >= QLTISYS_SIMD_MIN_LENGTH ) &&
+         ( QSIMD_NEON == qSIMD_Select() ) ) {
+        y = qLTISys_DotNEON( a, b, n );
+    }
+    else {
+        y = qLTISys_DotScalar( a, b, n );
+    }
+    #else
+    y = qLTISys_DotScalar( a, b, n );
+    #endif
+
+    return y;
+}
+/*============================================================================*/
+static float qLTISys_DotScalar( const float * const a,
+                                const float * const b,
+                                const size_t n )
 {
     size_t i;
     float y = 0.0f;
 
-    if ( NULL != c ) {
-        for ( i = ( wsize - 1u ) ; i >= 1u ; --i ) {
-            w[ i ] = w[ i - 1u ];
-            y += w[ i ]*c[ i ];
+    for ( i = 0u ; i < n ; ++i ) {
+        y += a[ i ]*b[ i ];
+    }
+
+    return y;
+}
+/*============================================================================*/
+static float qLTISys_SymDot( const float * const c,
+                             const float * const a,
+                             const float * const b,
+                             const size_t n )
+{
+    /*sum of c[i]*( a[i] + b[-i] ), b runs backwards*/
+    size_t i;
+    float y = 0.0f;
+
+    for ( i = 0u ; i < n ; ++i ) {
+        y += c[ i ]*( a[ i ] + *( b - i ) );
+    }
+
+    return y;
+}
+/*============================================================================*/
+static float qLTISys_Sum( const float * const a,
+                          const size_t n )
+{
+    size_t i;
+    float y = 0.0f;
+
+    for ( i = 0u ; i < n ; ++i ) {
+        y += a[ i ];
+    }
+
+    return y;
+}
+/*============================================================================*/
+float qLTISys_DiscreteFIRRingUpdate( float *w,
+                                     const float * const rc,
+                                     const size_t wsize,
+                                     size_t * const idx,
+                                     const float x )
+{
+    size_t k = *idx;
+    float y;
+
+    w[ k ] = x; /*the new sample takes the place of the oldest one*/
+    if ( ++k >= wsize ) {
+        k = 0u;
+    }
+    *idx = k;
+    /*in chronological order, the window is w[k..wsize-1] followed by w[0..k-1]*/
+    if ( NULL != rc ) {
+        y = qLTISys_Dot( &w[ k ], rc, wsize - k );
+        y += qLTISys_Dot( w, &rc[ wsize - k ], k );
+    }
+    else {
+        y = qLTISys_Sum( &w[ k ], wsize - k );
+        y += qLTISys_Sum( w, k );
+    }
+
+    return y;
+}
+/*============================================================================*/
+float qLTISys_DiscreteFIRSymRingUpdate( float *w,
+                                        const float * const c,
+                                        const size_t wsize,
+                                        size_t * const idx,
+                                        const float x )
+{
+    float y = 0.0f;
+
+    #if defined( QSIMD )
+    /*the vector kernels are bound by the loads, not by the multiplies, so
+    folding the window would only add shuffles*/
+    if ( ( wsize >= QLTISYS_SIMD_MIN_LENGTH ) &&
+         ( QSIMD_NONE != qSIMD_Select() ) ) {
+        y = qLTISys_DiscreteFIRRingUpdate( w, c, wsize, idx, x );
+    }
+    else
+    #endif
+    {
+        const size_t h = wsize/2u;
+        size_t lo = *idx; /*the oldest sample*/
+        size_t hi = lo; /*the new sample*/
+        size_t i = 0u;
+
+        w[ lo ] = x;
+        if ( ++lo >= wsize ) {
+            lo = 0u;
+        }
+        *idx = lo;
+        /*fold the i-th oldest and the i-th most recent samples, taking runs
+        where neither of them wraps around*/
+        while ( i < h ) {
+            size_t m = h - i;
+
+            m = ( m < ( wsize - lo ) )? m : ( wsize - lo );
+            m = ( m < ( hi + 1u ) )? m : ( hi + 1u );
+            y += qLTISys_SymDot( &c[ i ], &w[ lo ], &w[ hi ], m );
+            i += m;
+            lo += m;
+            lo = ( lo < wsize )? lo : 0u;
+            hi = ( hi >= m )? ( hi - m ) : ( ( hi + wsize ) - m );
+        }
+        if ( 0u != ( wsize & 1u ) ) {
+            y += c[ h ]*w[ lo ]; /*the center tap*/
+        }
+    }
+
+    return y;
+}
+/*============================================================================*/
+static void qLTISys_FFT( float * const z,
+                         const float * const tw,
+                         const size_t nfft,
+                         const int inverse )
+{
+    /*in-place radix-2 complex FFT of nfft/2 points, z holds interleaved
+    real and imaginary parts. The inverse transform is not scaled*/
+    const size_t n = nfft/2u;
+    const float sign = ( 0 != inverse )? -1.0f : 1.0f;
+    size_t i, j = 0u, len;
+
+    for ( i = 1u ; i < n ; ++i ) { /*bit-reversal permutation*/
+        size_t bit = n >> 1u;
+
+        for ( ; 0u != ( j & bit ) ; bit >>= 1u ) {
+            j ^= bit;
+        }
+        j |= bit;
+        if ( i < j ) {
+            float t = z[ 2u*i ];
+            z[ 2u*i ] = z[ 2u*j ];
+            z[ 2u*j ] = t;
+            t = z[ ( 2u*i ) + 1u ];
+            z[ ( 2u*i ) + 1u ] = z[ ( 2u*j ) + 1u ];
+            z[ ( 2u*j ) + 1u ] = t;
         }
-        y += c[ 0 ]*x;
+    }
+    for ( len = 2u ; len <= n ; len <<= 1u ) {
+        const size_t half = len >> 1u;
+        const size_t step = 2u*( nfft/len ); /*stride on the twiddle table*/
+        size_t k;
+
+        for ( k = 0u ; k < half ; ++k ) {
+            const float wr = tw[ k*step ];
+            const float wi = sign*tw[ ( k*step ) + 1u ];
+
+            for ( i = k ; i < n ; i += len ) {
+                float * const a = &z[ 2u*i ];
+                float * const b = &z[ 2u*( i + half ) ];
+                const float tr = ( wr*b[ 0 ] ) - ( wi*b[ 1 ] );
+                const float ti = ( wr*b[ 1 ] ) + ( wi*b[ 0 ] );
+
+                b[ 0 ] = a[ 0 ] - tr;
+                b[ 1 ] = a[ 1 ] - ti;
+                a[ 0 ] += tr;
+                a[ 1 ] += ti;
+            }
+        }
+    }
+}
+/*============================================================================*/
+static void qLTISys_RealFFT( float * const x,
+                             const float * const tw,
+                             const size_t nfft )
+{
+    /*the even and odd samples are transformed as the real and imaginary parts
+    of a half-size complex sequence, then split. The output is packed: the DC
+    and Nyquist terms in x[0] and x[1], followed by the bins 1 to nfft/2-1*/
+    const size_t n = nfft/2u;
+    float z0;
+    size_t k;
+
+    qLTISys_FFT( x, tw, nfft, 0 );
+    z0 = x[ 0 ];
+    x[ 0 ] = z0 + x[ 1 ];
+    x[ 1 ] = z0 - x[ 1 ];
+    for ( k = 1u ; k <= ( n/2u ) ; ++k ) {
+        float * const a = &x[ 2u*k ];
+        float * const b = &x[ 2u*( n - k ) ];
+        const float er = 0.5f*( a[ 0 ] + b[ 0 ] );
+        const float ei = 0.5f*( a[ 1 ] - b[ 1 ] );
+        const float orr = 0.5f*( a[ 1 ] + b[ 1 ] );
+        const float oi = -0.5f*( a[ 0 ] - b[ 0 ] );
+        const float tr = ( tw[ 2u*k ]*orr ) - ( tw[ ( 2u*k ) + 1u ]*oi );
+        const float ti = ( tw[ 2u*k ]*oi ) + ( tw[ ( 2u*k ) + 1u ]*orr );
+
+        b[ 0 ] = er - tr;
+        b[ 1 ] = ti - ei;
+        a[ 0 ] = er + tr;
+        a[ 1 ] = ei + ti;
+    }
+}
+/*============================================================================*/
+static void qLTISys_RealIFFT( float * const x,
+                              const float * const tw,
+                              const size_t nfft )
+{
+    /*inverse of qLTISys_RealFFT() scaled by nfft*/
+    const size_t n = nfft/2u;
+    const float x0 = x[ 0 ];
+    size_t k;
+
+    x[ 0 ] = x0 + x[ 1 ];
+    x[ 1 ] = x0 - x[ 1 ];
+    for ( k = 1u ; k <= ( n/2u ) ; ++k ) {
+        float * const a = &x[ 2u*k ];
+        float * const b = &x[ 2u*( n - k ) ];
+        const float er = a[ 0 ] + b[ 0 ];
+        const float ei = a[ 1 ] - b[ 1 ];
+        const float dr = a[ 0 ] - b[ 0 ];
+        const float di = a[ 1 ] + b[ 1 ];
+        const float gr = ( tw[ 2u*k ]*dr ) + ( tw[ ( 2u*k ) + 1u ]*di );
+        const float gi = ( tw[ 2u*k ]*di ) - ( tw[ ( 2u*k ) + 1u ]*dr );
+
+        b[ 0 ] = er + gi;
+        b[ 1 ] = gr - ei;
+        a[ 0 ] = er - gi;
+        a[ 1 ] = ei + gr;
+    }
+    qLTISys_FFT( x, tw, nfft, 1 );
+}
+/*============================================================================*/
+int qLTISys_FFTConv_Setup( qLTISys_FFTConv_t * const e,
+                           float * const area,
+                           const size_t nfft,
+                           const float * const rc,
+                           const size_t ntaps )
+{
+    int retValue = 0;
+
+    if ( ( NULL != e ) && ( NULL != area ) && ( NULL != rc ) && ( ntaps > 0u ) &&
+         ( nfft >= 4u ) && ( nfft >= ( 2u*ntaps ) ) &&
+         ( 0u == ( nfft & ( nfft - 1u ) ) ) ) {
+        const float scale = 1.0f/(float)nfft;
+        size_t i;
+
+        e->h = area;
+        e->buf = &area[ nfft ];
+        e->tw = &area[ 2u*nfft ];
+        e->nfft = nfft;
+        e->ntaps = ntaps;
+        /*twiddle factors exp( -j*2*pi*k/nfft ) for k < nfft/2*/
+        for ( i = 0u ; i < ( nfft/2u ) ; ++i ) {
+            /*cstat -CERT-FLP36-C*/
+            const double a = ( 6.283185307179586*(double)i )/(double)nfft;
+            /*cstat +CERT-FLP36-C*/
+            e->tw[ 2u*i ] = (float)cos( a );
+            e->tw[ ( 2u*i ) + 1u ] = (float)-sin( a );
+        }
+        /*the impulse response has the most recent coefficient first*/
+        for ( i = 0u ; i < nfft ; ++i ) {
+            e->h[ i ] = ( i < ntaps )? ( scale*rc[ ntaps - 1u - i ] ) : 0.0f;
+        }
+        qLTISys_RealFFT( e->h, e->tw, nfft );
+        retValue = 1;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static void qLTISys_FFTConv_Block( qLTISys_FFTConv_t * const e,
+                                   float * const y,
+                                   const size_t n )
+{
+    /*circular convolution of the frame, only its last n outputs are free of
+    wrap-around*/
+    const size_t nfft = e->nfft;
+    float * const x = e->buf;
+    const float * const h = e->h;
+    size_t k;
+
+    qLTISys_RealFFT( x, e->tw, nfft );
+    x[ 0 ] *= h[ 0 ];
+    x[ 1 ] *= h[ 1 ];
+    for ( k = 2u ; k < nfft ; k += 2u ) {
+        const float xr = x[ k ];
+
+        x[ k ] = ( xr*h[ k ] ) - ( x[ k + 1u ]*h[ k + 1u ] );
+        x[ k + 1u ] = ( xr*h[ k + 1u ] ) + ( x[ k + 1u ]*h[ k ] );
+    }
+    qLTISys_RealIFFT( x, e->tw, nfft );
+    (void)memcpy( y, &x[ nfft - n ], n*sizeof(float) );
+}
+/*============================================================================*/
+static void qLTISys_RingInsert( float * const w,
+                                const size_t wsize,
+                                size_t * const idx,
+                                const float * const x,
+                                const size_t n )
+{
+    if ( n >= wsize ) {
+        (void)memcpy( w, &x[ n - wsize ], wsize*sizeof(float) );
+        *idx = 0u;
     }
     else {
-        for ( i = ( wsize - 1u ) ; i >= 1u ; --i ) {
-            w[ i ] = w[ i - 1u ];
-            y += w[ i ];
+        const size_t k = *idx;
+        const size_t first = ( n < ( wsize - k ) )? n : ( wsize - k );
+
+        (void)memcpy( &w[ k ], x, first*sizeof(float) );
+        (void)memcpy( w, &x[ first ], ( n - first )*sizeof(float) );
+        *idx = ( ( k + n ) < wsize )? ( k + n ) : ( ( k + n ) - wsize );
+    }
+}
+/*============================================================================*/
+int qLTISys_DiscreteFIRRingBlock( float *w,
+                                  const float * const rc,
+                                  const size_t wsize,
+                                  size_t * const idx,
+                                  const float * const x,
+                                  float * const y,
+                                  const size_t n,
+                                  qLTISys_FFTConv_t * const e )
+{
+    int retValue = 0;
+
+    if ( ( NULL != w ) && ( NULL != rc ) && ( NULL != idx ) &&
+         ( NULL != x ) && ( NULL != y ) && ( wsize > 0u ) ) {
+        size_t i = 0u;
+        size_t span = 0u; /*samples per FFT block, zero to use the direct form*/
+
+        if ( ( NULL != e ) && ( e->ntaps == wsize ) &&
+             ( wsize >= QLTISYS_FFTCONV_MIN_TAPS ) ) {
+            span = e->nfft - wsize + 1u;
         }
-        y += x;
+        /*a FFT block pays off when it yields at least a quarter of its span*/
+        while ( ( span > 0u ) && ( ( n - i ) >= ( span/4u ) ) ) {
+            const size_t r = ( ( n - i ) < span )? ( n - i ) : span;
+            float * const f = e->buf;
+            const size_t h0 = e->nfft - r - ( wsize - 1u );
+            const size_t k = *idx + 1u;
+
+            /*frame: zeros, the last wsize-1 samples of the window and the
+            new samples, all in chronological order*/
+            (void)memset( f, 0, h0*sizeof(float) );
+            if ( k < wsize ) {
+                (void)memcpy( &f[ h0 ], &w[ k ], ( wsize - k )*sizeof(float) );
+                (void)memcpy( &f[ h0 + ( wsize - k ) ], w, ( k - 1u )*sizeof(float) );
+            }
+            else {
+                (void)memcpy( &f[ h0 ], w, ( wsize - 1u )*sizeof(float) );
+            }
+            (void)memcpy( &f[ e->nfft - r ], &x[ i ], r*sizeof(float) );
+            /*the input is consumed before the output is written, since both
+            can be the same array*/
+            qLTISys_RingInsert( w, wsize, idx, &x[ i ], r );
+            qLTISys_FFTConv_Block( e, &y[ i ], r );
+            i += r;
+        }
+        for ( ; i < n ; ++i ) {
+            y[ i ] = qLTISys_DiscreteFIRRingUpdate( w, rc, wsize, idx, x[ i ] );
+        }
+        retValue = 1;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+#if defined( QSIMD_X86 )
+__attribute__(( target( "sse2" ) ))
+static float qLTISys_HSumSSE2( const __m128 v )
+{
+    __m128 t = _mm_add_ps( v, _mm_movehl_ps( v, v ) );
+
+    t = _mm_add_ss( t, _mm_shuffle_ps( t, t, 1 ) );
+
+    return _mm_cvtss_f32( t );
+}
+/*============================================================================*/
+__attribute__(( target( "sse2" ) ))
+static float qLTISys_DotSSE2( const float * const a,
+                              const float * const b,
+                              const size_t n )
+{
+    __m128 s0 = _mm_setzero_ps();
+    __m128 s1 = _mm_setzero_ps();
+    size_t i;
+    float y;
+
+    for ( i = 0u ; ( i + 8u ) <= n ; i += 8u ) {
+        s0 = _mm_add_ps( s0, _mm_mul_ps( _mm_loadu_ps( &a[ i ] ),
+                                         _mm_loadu_ps( &b[ i ] ) ) );
+        s1 = _mm_add_ps( s1, _mm_mul_ps( _mm_loadu_ps( &a[ i + 4u ] ),
+                                         _mm_loadu_ps( &b[ i + 4u ] ) ) );
+    }
+    y = qLTISys_HSumSSE2( _mm_add_ps( s0, s1 ) );
+    for ( ; i < n ; ++i ) {
+        y += a[ i ]*b[ i ];
     }
-    w[ 0 ] = x;
 
     return y;
 }
-/*============================================================================*/
\ No newline at end of file
+/*============================================================================*/
+__attribute__(( target( "avx2,fma" ) ))
+static float qLTISys_DotAVX2( const float * const a,
+                              const float * const b,
+                              const size_t n )
+{
+    __m256 s0 = _mm256_setzero_ps();
+    __m256 s1 = _mm256_setzero_ps();
+    size_t i;
+    float y;
+
+    for ( i = 0u ; ( i + 16u ) <= n ; i += 16u ) {
+        s0 = _mm256_fmadd_ps( _mm256_loadu_ps( &a[ i ] ),
+                              _mm256_loadu_ps( &b[ i ] ), s0 );
+        s1 = _mm256_fmadd_ps( _mm256_loadu_ps( &a[ i + 8u ] ),
+                              _mm256_loadu_ps( &b[ i + 8u ] ), s1 );
+    }
+    if ( ( i + 8u ) <= n ) {
+        s0 = _mm256_fmadd_ps( _mm256_loadu_ps( &a[ i ] ),
+                              _mm256_loadu_ps( &b[ i ] ), s0 );
+        i += 8u;
+    }
+    s0 = _mm256_add_ps( s0, s1 );
+    y = qLTISys_HSumSSE2( _mm_add_ps( _mm256_castps256_ps128( s0 ),
+                                      _mm256_extractf128_ps( s0, 1 ) ) );
+    for ( ; i < n ; ++i ) {
+        y += a[ i ]*b[ i ];
+    }
+
+    return y;
+}
+/*============================================================================*/
+__attribute__(( target( "avx512f" ) ))
+static float qLTISys_DotAVX512( const float * const a,
+                                const float * const b,
+                                const size_t n )
+{
+    __m512 s0 = _mm512_setzero_ps();
+    __m512 s1 = _mm512_setzero_ps();
+    size_t i;
+
+    for ( i = 0u ; ( i + 32u ) <= n ; i += 32u ) {
+        s0 = _mm512_fmadd_ps( _mm512_loadu_ps( &a[ i ] ),
+                              _mm512_loadu_ps( &b[ i ] ), s0 );
+        s1 = _mm512_fmadd_ps( _mm512_loadu_ps( &a[ i + 16u ] ),
+                              _mm512_loadu_ps( &b[ i + 16u ] ), s1 );
+    }
+    for ( ; i < n ; i += 16u ) {
+        /*masked loads handle the tail without reading past the arrays*/
+        const size_t r = ( ( n - i ) < 16u )? ( n - i ) : 16u;
+        const __mmask16 m = (__mmask16)( ( 1uL << r ) - 1uL );
+
+        s0 = _mm512_fmadd_ps( _mm512_maskz_loadu_ps( m, &a[ i ] ),
+                              _mm512_maskz_loadu_ps( m, &b[ i ] ), s0 );
+    }
+
+    return _mm512_reduce_add_ps( _mm512_add_ps( s0, s1 ) );
+}
+/*============================================================================*/
+#endif
+#if defined( QSIMD_ARM )
+static float qLTISys_DotNEON( const float * const a,
+                              const float * const b,
+                              const size_t n )
+{
+    float32x4_t s0 = vdupq_n_f32( 0.0f );
+    float32x4_t s1 = vdupq_n_f32( 0.0f );
+    size_t i;
+    float y;
+
+    for ( i = 0u ; ( i + 8u ) <= n ; i += 8u ) {
+        s0 = vfmaq_f32( s0, vld1q_f32( &a[ i ] ), vld1q_f32( &b[ i ] ) );
+        s1 = vfmaq_f32( s1, vld1q_f32( &a[ i + 4u ] ), vld1q_f32( &b[ i + 4u ] ) );
+    }
+    y = vaddvq_f32( vaddq_f32( s0, s1 ) );
+    for ( ; i < n ; ++i ) {
+        y += a[ i ]*b[ i ];
+    }
+
+    return y;
+}
+/*============================================================================*/
+#endif
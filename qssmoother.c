@@ -6,12 +6,29 @@
 
 #include "qssmoother.h"
 #include "qltisys.h"
+#include <string.h>
+
+#if defined( QSSMOOTHER_NO_SIMD )
+    #define QSIMD_DISABLE
+#endif
+#include "qsimd.h"
 
 struct qSmoother_Vtbl_s {
     float (*perform)( _qSSmoother_t * const f, const float x );
     int (*setup)( _qSSmoother_t * const f, const float * const param, float *window, const size_t wsize );
+    void (*block)( _qSSmoother_t * const f, const float * const x, float * const y, const size_t n );
+};
+
+struct qSmoother_Bank_Vtbl_s {
+    int (*setup)( _qSSmoother_Bank_t * const b, const float * const param, float *area );
+    void (*block)( _qSSmoother_Bank_t * const b, const float * const x, float * const y, const size_t n );
 };
 
+/*complex number used by the design of the SOS filters*/
+typedef struct {
+    double r, i;
+} qSSmoother_Complex_t;
+
 static float qSSmoother_Abs( float x );
 static void qSSmoother_WindowSet( float *w,
                                   size_t wsize, float x );
@@ -51,6 +68,22 @@ static int qSSmoother_Setup_EXPW( _qSSmoother_t * const f,
                                   const float * const param,
                                   float *window,
                                   const size_t wsize );
+static int qSSmoother_Setup_MEDN( _qSSmoother_t * const f,
+                                  const float * const param,
+                                  float *window,
+                                  const size_t wsize );
+static int qSSmoother_Setup_HMPL( _qSSmoother_t * const f,
+                                  const float * const param,
+                                  float *window,
+                                  const size_t wsize );
+static int qSSmoother_Setup_MMAX( _qSSmoother_t * const f,
+                                  const float * const param,
+                                  float *window,
+                                  const size_t wsize );
+static int qSSmoother_Setup_SOS( _qSSmoother_t * const f,
+                                 const float * const param,
+                                 float *window,
+                                 const size_t wsize );
 static float qSSmoother_Filter_LPF1( _qSSmoother_t * const f,
                                      const float x );
 static float qSSmoother_Filter_LPF2( _qSSmoother_t * const f,
@@ -69,6 +102,293 @@ static float qSSmoother_Filter_KLMN( _qSSmoother_t * const f,
                                      const float x );
 static float qSSmoother_Filter_EXPW( _qSSmoother_t * const f,
                                      const float x );
+static float qSSmoother_Filter_MEDN( _qSSmoother_t * const f,
+                                     const float x );
+static float qSSmoother_Filter_HMPL( _qSSmoother_t * const f,
+                                     const float x );
+static float qSSmoother_Filter_MMAX( _qSSmoother_t * const f,
+                                     const float x );
+static float qSSmoother_Filter_SOS( _qSSmoother_t * const f,
+                                    const float x );
+static void qSSmoother_Block_LPF1( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n );
+static void qSSmoother_Block_LPF2( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n );
+static void qSSmoother_Block_MWM1( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n );
+static void qSSmoother_Block_MWM2( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n );
+static void qSSmoother_Block_MOR1( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n );
+static void qSSmoother_Block_MOR2( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n );
+static void qSSmoother_Block_GMWF( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n );
+static void qSSmoother_Block_KLMN( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n );
+static void qSSmoother_Block_EXPW( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n );
+static void qSSmoother_Block_MEDN( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n );
+static void qSSmoother_Block_HMPL( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n );
+static void qSSmoother_Block_MMAX( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n );
+static void qSSmoother_Block_SOS( _qSSmoother_t * const f,
+                                  const float * const x,
+                                  float * const y,
+                                  const size_t n );
+static int32_t qSSmoother_GetIndex( const float * const a,
+                                    const int32_t i );
+static void qSSmoother_SetIndex( float * const a,
+                                 const int32_t i,
+                                 const int32_t v );
+static int qSSmoother_MednLess( const qSSmoother_MEDN_t * const s,
+                                const int32_t i,
+                                const int32_t j );
+static int qSSmoother_MednExchange( const qSSmoother_MEDN_t * const s,
+                                    const int32_t i,
+                                    const int32_t j );
+static void qSSmoother_MednMinSortDown( const qSSmoother_MEDN_t * const s,
+                                        int32_t i );
+static void qSSmoother_MednMaxSortDown( const qSSmoother_MEDN_t * const s,
+                                        int32_t i );
+static int qSSmoother_MednMinSortUp( const qSSmoother_MEDN_t * const s,
+                                     int32_t i );
+static int qSSmoother_MednMaxSortUp( const qSSmoother_MEDN_t * const s,
+                                     int32_t i );
+static void qSSmoother_MednInsert( qSSmoother_MEDN_t * const s,
+                                   const float x );
+static float qSSmoother_MednGet( const qSSmoother_MEDN_t * const s );
+static int32_t qSSmoother_HmplGet( const qSSmoother_HMPL_t * const s,
+                                   const int32_t node,
+                                   const int32_t field );
+static void qSSmoother_HmplSet( const qSSmoother_HMPL_t * const s,
+                                const int32_t node,
+                                const int32_t field,
+                                const int32_t v );
+static int32_t qSSmoother_HmplSize( const qSSmoother_HMPL_t * const s,
+                                    const int32_t node );
+static int qSSmoother_HmplBefore( const qSSmoother_HMPL_t * const s,
+                                  const int32_t i,
+                                  const int32_t j );
+static void qSSmoother_HmplRotateUp( qSSmoother_HMPL_t * const s,
+                                     const int32_t x );
+static void qSSmoother_HmplLink( qSSmoother_HMPL_t * const s,
+                                 const int32_t k );
+static void qSSmoother_HmplUnlink( qSSmoother_HMPL_t * const s,
+                                   const int32_t k );
+static float qSSmoother_HmplSelect( const qSSmoother_HMPL_t * const s,
+                                    int32_t r );
+static float qSSmoother_HmplDeviation( const qSSmoother_HMPL_t * const s,
+                                       const float m,
+                                       const int32_t k );
+static float qSSmoother_HmplUpdate( qSSmoother_HMPL_t * const s,
+                                    const float x );
+static float qSSmoother_MmaxPush( float * const q,
+                                  const size_t n,
+                                  size_t * const head,
+                                  size_t * const count,
+                                  const uint32_t t,
+                                  const float x );
+static float qSSmoother_MmaxUpdate( qSSmoother_MMAX_t * const s,
+                                    const float x );
+static size_t qSSmoother_SosCheck( const float * const c );
+static void qSSmoother_SosSeed( const float * const c,
+                                float * const d,
+                                const size_t ns,
+                                const size_t stride,
+                                const float x );
+static qSSmoother_Complex_t qSSmoother_CMul( const qSSmoother_Complex_t a,
+                                             const qSSmoother_Complex_t b );
+static qSSmoother_Complex_t qSSmoother_CDiv( const qSSmoother_Complex_t a,
+                                             const qSSmoother_Complex_t b );
+static qSSmoother_Complex_t qSSmoother_CSqrt( const qSSmoother_Complex_t a );
+static qSSmoother_Complex_t qSSmoother_Bilinear( const qSSmoother_Complex_t s );
+static void qSSmoother_SosSection( float * const c,
+                                   const qSSmoother_Complex_t p1,
+                                   const qSSmoother_Complex_t p2,
+                                   const double b1,
+                                   const double b2,
+                                   const qSSmoother_Complex_t zr );
+static void qSSmoother_LPF2Coeffs( const float alpha,
+                                   float * const k,
+                                   float * const a1,
+                                   float * const a2,
+                                   float * const b1 );
+static int qSSmoother_Bank_Setup_LPF1( _qSSmoother_Bank_t * const b,
+                                       const float * const param,
+                                       float *area );
+static int qSSmoother_Bank_Setup_LPF2( _qSSmoother_Bank_t * const b,
+                                       const float * const param,
+                                       float *area );
+static int qSSmoother_Bank_Setup_KLMN( _qSSmoother_Bank_t * const b,
+                                       const float * const param,
+                                       float *area );
+static int qSSmoother_Bank_Setup_EXPW( _qSSmoother_Bank_t * const b,
+                                       const float * const param,
+                                       float *area );
+static int qSSmoother_Bank_Setup_SOS( _qSSmoother_Bank_t * const b,
+                                      const float * const param,
+                                      float *area );
+static void qSSmoother_Bank_Block_LPF1( _qSSmoother_Bank_t * const b,
+                                        const float * const x,
+                                        float * const y,
+                                        const size_t n );
+static void qSSmoother_Bank_Block_LPF2( _qSSmoother_Bank_t * const b,
+                                        const float * const x,
+                                        float * const y,
+                                        const size_t n );
+static void qSSmoother_Bank_Block_KLMN( _qSSmoother_Bank_t * const b,
+                                        const float * const x,
+                                        float * const y,
+                                        const size_t n );
+static void qSSmoother_Bank_Block_EXPW( _qSSmoother_Bank_t * const b,
+                                        const float * const x,
+                                        float * const y,
+                                        const size_t n );
+static void qSSmoother_Bank_Block_SOS( _qSSmoother_Bank_t * const b,
+                                       const float * const x,
+                                       float * const y,
+                                       const size_t n );
+static void qSSmoother_BankLerp( float * const s,
+                                 const float * const p,
+                                 const float * const q,
+                                 float * const y,
+                                 const size_t nc,
+                                 const float c,
+                                 const uint8_t simd );
+static void qSSmoother_BankMix( float * const s,
+                                const float * const x,
+                                float * const y,
+                                const size_t nc,
+                                const float a,
+                                const float c,
+                                const uint8_t simd );
+static void qSSmoother_BankBiquad( const qSSmoother_LPF2_Bank_t * const s,
+                                   const float * const x,
+                                   float * const y );
+static void qSSmoother_BankSos( const qSSmoother_SOS_Bank_t * const s,
+                                const float * const x,
+                                float * const y );
+#if defined( QSIMD_X86 )
+static size_t qSSmoother_BankLerpSSE2( float * const s,
+                                       const float * const p,
+                                       const float * const q,
+                                       float * const y,
+                                       const size_t nc,
+                                       const float c );
+static size_t qSSmoother_BankLerpAVX2( float * const s,
+                                       const float * const p,
+                                       const float * const q,
+                                       float * const y,
+                                       const size_t nc,
+                                       const float c );
+static size_t qSSmoother_BankLerpAVX512( float * const s,
+                                         const float * const p,
+                                         const float * const q,
+                                         float * const y,
+                                         const size_t nc,
+                                         const float c );
+static size_t qSSmoother_BankMixSSE2( float * const s,
+                                      const float * const x,
+                                      float * const y,
+                                      const size_t nc,
+                                      const float a,
+                                      const float c );
+static size_t qSSmoother_BankMixAVX2( float * const s,
+                                      const float * const x,
+                                      float * const y,
+                                      const size_t nc,
+                                      const float a,
+                                      const float c );
+static size_t qSSmoother_BankMixAVX512( float * const s,
+                                        const float * const x,
+                                        float * const y,
+                                        const size_t nc,
+                                        const float a,
+                                        const float c );
+static size_t qSSmoother_BankBiquadSSE2( const qSSmoother_LPF2_Bank_t * const s,
+                                         const float * const x,
+                                         float * const y );
+static size_t qSSmoother_BankBiquadAVX2( const qSSmoother_LPF2_Bank_t * const s,
+                                         const float * const x,
+                                         float * const y );
+static size_t qSSmoother_BankBiquadAVX512( const qSSmoother_LPF2_Bank_t * const s,
+                                           const float * const x,
+                                           float * const y );
+static size_t qSSmoother_BankSosSSE2( const qSSmoother_SOS_Bank_t * const s,
+                                      const float * const x,
+                                      float * const y );
+static size_t qSSmoother_BankSosAVX2( const qSSmoother_SOS_Bank_t * const s,
+                                      const float * const x,
+                                      float * const y );
+static size_t qSSmoother_BankSosAVX512( const qSSmoother_SOS_Bank_t * const s,
+                                        const float * const x,
+                                        float * const y );
+static void qSSmoother_SosGroupSSE2( const float * const c,
+                                     float * const d,
+                                     const float * const x,
+                                     float * const y,
+                                     const size_t n );
+#endif
+#if defined( QSIMD_ARM )
+static size_t qSSmoother_BankLerpNEON( float * const s,
+                                       const float * const p,
+                                       const float * const q,
+                                       float * const y,
+                                       const size_t nc,
+                                       const float c );
+static size_t qSSmoother_BankMixNEON( float * const s,
+                                      const float * const x,
+                                      float * const y,
+                                      const size_t nc,
+                                      const float a,
+                                      const float c );
+static size_t qSSmoother_BankBiquadNEON( const qSSmoother_LPF2_Bank_t * const s,
+                                         const float * const x,
+                                         float * const y );
+static size_t qSSmoother_BankSosNEON( const qSSmoother_SOS_Bank_t * const s,
+                                      const float * const x,
+                                      float * const y );
+static void qSSmoother_SosGroupNEON( const float * const c,
+                                     float * const d,
+                                     const float * const x,
+                                     float * const y,
+                                     const size_t n );
+#endif
+
+/*fields of each node of the HMPL tree*/
+#define QSSMOOTHER_HMPL_LEFT        ( 0 )
+#define QSSMOOTHER_HMPL_RIGHT       ( 1 )
+#define QSSMOOTHER_HMPL_PARENT      ( 2 )
+#define QSSMOOTHER_HMPL_SIZE        ( 3 )
+#define QSSMOOTHER_HMPL_PRIORITY    ( 4 )
+#define QSSMOOTHER_HMPL_FIELDS      ( 5 )
 
 /*============================================================================*/
 int qSSmoother_Setup( qSSmootherPtr_t * const s,
@@ -77,16 +397,20 @@ int qSSmoother_Setup( qSSmootherPtr_t * const s,
                       float *window,
                       const size_t wsize )
 {
-    static struct qSmoother_Vtbl_s qSmoother_Vtbl[ 9 ] = {
-        { &qSSmoother_Filter_LPF1, &qSSmoother_Setup_LPF1 },
-        { &qSSmoother_Filter_LPF2, &qSSmoother_Setup_LPF2 },
-        { &qSSmoother_Filter_MWM1, &qSSmoother_Setup_MWM1 },
-        { &qSSmoother_Filter_MWM2, &qSSmoother_Setup_MWM2 },
-        { &qSSmoother_Filter_MOR1, &qSSmoother_Setup_MOR1 },
-        { &qSSmoother_Filter_MOR2, &qSSmoother_Setup_MOR2 },
-        { &qSSmoother_Filter_GMWF, &qSSmoother_Setup_GMWF },
-        { &qSSmoother_Filter_KLMN, &qSSmoother_Setup_KLMN },
-        { &qSSmoother_Filter_EXPW, &qSSmoother_Setup_EXPW },
+    static struct qSmoother_Vtbl_s qSmoother_Vtbl[ 13 ] = {
+        { &qSSmoother_Filter_LPF1, &qSSmoother_Setup_LPF1, &qSSmoother_Block_LPF1 },
+        { &qSSmoother_Filter_LPF2, &qSSmoother_Setup_LPF2, &qSSmoother_Block_LPF2 },
+        { &qSSmoother_Filter_MWM1, &qSSmoother_Setup_MWM1, &qSSmoother_Block_MWM1 },
+        { &qSSmoother_Filter_MWM2, &qSSmoother_Setup_MWM2, &qSSmoother_Block_MWM2 },
+        { &qSSmoother_Filter_MOR1, &qSSmoother_Setup_MOR1, &qSSmoother_Block_MOR1 },
+        { &qSSmoother_Filter_MOR2, &qSSmoother_Setup_MOR2, &qSSmoother_Block_MOR2 },
+        { &qSSmoother_Filter_GMWF, &qSSmoother_Setup_GMWF, &qSSmoother_Block_GMWF },
+        { &qSSmoother_Filter_KLMN, &qSSmoother_Setup_KLMN, &qSSmoother_Block_KLMN },
+        { &qSSmoother_Filter_EXPW, &qSSmoother_Setup_EXPW, &qSSmoother_Block_EXPW },
+        { &qSSmoother_Filter_MEDN, &qSSmoother_Setup_MEDN, &qSSmoother_Block_MEDN },
+        { &qSSmoother_Filter_HMPL, &qSSmoother_Setup_HMPL, &qSSmoother_Block_HMPL },
+        { &qSSmoother_Filter_MMAX, &qSSmoother_Setup_MMAX, &qSSmoother_Block_MMAX },
+        { &qSSmoother_Filter_SOS, &qSSmoother_Setup_SOS, &qSSmoother_Block_SOS },
     };
     int retValue = 0;
     const size_t maxTypes = sizeof(qSmoother_Vtbl)/sizeof(qSmoother_Vtbl[ 0 ] );
@@ -135,16 +459,7 @@ static int qSSmoother_Setup_LPF2( _qSSmoother_t * const f,
         /*cstat -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d -CERT-EXP36-C_a*/
         qSSmoother_LPF2_t * const s = (qSSmoother_LPF2_t* const)f;
         /*cstat +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d +CERT-EXP36-C_a*/
-        float aa, p1, r;
-        aa = alpha*alpha;
-        /*cstat -MISRAC2012-Dir-4.11_b*/
-        p1 = sqrtf( 2.0f*alpha ); /*arg always positive*/
-        /*cstat +MISRAC2012-Dir-4.11_b*/
-        r = 1.0f + p1 + aa;
-        s->k = aa/r;
-        s->a1 = 2.0f*( aa - 1.0f )/r;
-        s->a2 = ( 1.0f - p1 + aa )/r;
-        s->b1 = 2.0f*s->k;
+        qSSmoother_LPF2Coeffs( alpha, &s->k, &s->a1, &s->a2, &s->b1 );
         retValue = qSSmoother_Reset( s );
         (void)window;
         (void)wsize;
@@ -153,6 +468,25 @@ static int qSSmoother_Setup_LPF2( _qSSmoother_t * const f,
     return retValue;
 }
 /*============================================================================*/
+static void qSSmoother_LPF2Coeffs( const float alpha,
+                                   float * const k,
+                                   float * const a1,
+                                   float * const a2,
+                                   float * const b1 )
+{
+    float aa, p1, r;
+
+    aa = alpha*alpha;
+    /*cstat -MISRAC2012-Dir-4.11_b*/
+    p1 = sqrtf( 2.0f*alpha ); /*arg always positive*/
+    /*cstat +MISRAC2012-Dir-4.11_b*/
+    r = 1.0f + p1 + aa;
+    *k = aa/r;
+    *a1 = 2.0f*( aa - 1.0f )/r;
+    *a2 = ( 1.0f - p1 + aa )/r;
+    *b1 = 2.0f*( *k );
+}
+/*============================================================================*/
 static int qSSmoother_Setup_MWM1( _qSSmoother_t * const f,
                                   const float * const param,
                                   float *window,
@@ -260,19 +594,31 @@ static int qSSmoother_Setup_GMWF( _qSSmoother_t * const f,
         l = (float)( wsize - 1u )/2.0f;
         center = (float)c - l;
         r = 2.0f*sg*sg;
+        /*the kernel is stored in reverse order, so it runs forward over the
+        circular window, from the oldest to the most recent sample*/
         for ( i = 0u ; i < ws ; ++i ) {
             float d = (float)i - l; /*symmetry*/
             d -= center;
-            kernel[ i ] =  expf( -( d*d )/r );
-            sum += kernel[ i ];
+            kernel[ ws - 1u - i ] =  expf( -( d*d )/r );
+            sum += kernel[ ws - 1u - i ];
         }
         /*cstat +CERT-FLP36-C +MISRAC2012-Rule-10.8*/
         for ( i = 0u ; i < ws ; ++i ) {
             kernel[ i ] /= sum;
         }
+        /*a centered kernel is symmetric, so only half of the multiplies
+        are needed*/
+        s->sym = 1u;
+        for ( i = 0u ; i < ( ws/2u ) ; ++i ) {
+            if ( kernel[ i ] != kernel[ ws - 1u - i ] ) {
+                s->sym = 0u;
+                break;
+            }
+        }
         s->w = window;
         s->k = kernel;
         s->wsize = ws;
+        s->fft.h = NULL;
         retValue = qSSmoother_Reset( s );
     }
 
@@ -329,6 +675,101 @@ static int qSSmoother_Setup_EXPW( _qSSmoother_t * const f,
     return retValue;
 }
 /*============================================================================*/
+static int qSSmoother_Setup_MEDN( _qSSmoother_t * const f,
+                                  const float * const param,
+                                  float *window,
+                                  const size_t wsize )
+{
+    int retValue = 0;
+    const size_t n = wsize/3u;
+
+    if ( ( NULL != window ) && ( n > 0u ) && ( n <= (size_t)INT32_MAX ) ) {
+        /*cstat -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d -CERT-EXP36-C_a*/
+        qSSmoother_MEDN_t * const s = (qSSmoother_MEDN_t* const)f;
+        /*cstat +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d +CERT-EXP36-C_a*/
+        s->wsize = n;
+        s->w = window;
+        s->pos = &window[ n ];
+        /*heap indexes go from -n/2 ( max-heap ) to (n-1)/2 ( min-heap )*/
+        s->heap = &window[ ( 2u*n ) + ( n/2u ) ];
+        retValue = qSSmoother_Reset( s );
+        (void)param;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static int qSSmoother_Setup_HMPL( _qSSmoother_t * const f,
+                                  const float * const param,
+                                  float *window,
+                                  const size_t wsize )
+{
+    int retValue = 0;
+    const size_t n = wsize/6u;
+    float t = param[ 0 ];
+
+    if ( ( NULL != window ) && ( n > 0u ) && ( t > 0.0f ) &&
+         ( n <= ( (size_t)INT32_MAX/5u ) ) ) {
+        /*cstat -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d -CERT-EXP36-C_a*/
+        qSSmoother_HMPL_t * const s = (qSSmoother_HMPL_t* const)f;
+        /*cstat +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d +CERT-EXP36-C_a*/
+        s->wsize = n;
+        s->w = window;
+        s->t = &window[ n ];
+        /*1.4826*MAD estimates the standard deviation of normal data*/
+        s->k = 1.4826f*t;
+        retValue = qSSmoother_Reset( s );
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static int qSSmoother_Setup_MMAX( _qSSmoother_t * const f,
+                                  const float * const param,
+                                  float *window,
+                                  const size_t wsize )
+{
+    int retValue = 0;
+    const size_t n = wsize/4u;
+    float out = param[ 0 ];
+
+    if ( ( NULL != window ) && ( n > 0u ) && ( n <= (size_t)UINT32_MAX ) &&
+         ( ( 0.0f == out ) || ( 1.0f == out ) || ( 2.0f == out ) ) ) {
+        /*cstat -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d -CERT-EXP36-C_a*/
+        qSSmoother_MMAX_t * const s = (qSSmoother_MMAX_t* const)f;
+        /*cstat +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d +CERT-EXP36-C_a*/
+        s->wsize = n;
+        s->q = window;
+        s->out = (uint8_t)out;
+        retValue = qSSmoother_Reset( s );
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static int qSSmoother_Setup_SOS( _qSSmoother_t * const f,
+                                 const float * const param,
+                                 float *window,
+                                 const size_t wsize )
+{
+    int retValue = 0;
+    const size_t ns = qSSmoother_SosCheck( param );
+
+    if ( ( NULL != window ) && ( ns > 0u ) && ( wsize >= ( 7u*ns ) ) ) {
+        /*cstat -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d -CERT-EXP36-C_a*/
+        qSSmoother_SOS_t * const s = (qSSmoother_SOS_t* const)f;
+        /*cstat +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d +CERT-EXP36-C_a*/
+        s->ns = ns;
+        s->c = window;
+        s->d = &window[ 5u*ns ];
+        s->simd = qSIMD_Select();
+        (void)memcpy( s->c, &param[ 1 ], 5u*ns*sizeof(float) );
+        retValue = qSSmoother_Reset( s );
+    }
+
+    return retValue;
+}
+/*============================================================================*/
 static float qSSmoother_Abs( const float x )
 {
     return ( x < 0.0f )? -x : x;
@@ -392,184 +833,2524 @@ float qSSmoother_Perform( qSSmootherPtr_t * const s,
     return retValue;
 }
 /*============================================================================*/
-static float qSSmoother_Filter_LPF1( _qSSmoother_t *f,
-                                     const float x )
+int qSSmoother_PerformBlock( qSSmootherPtr_t * const s,
+                             const float * const x,
+                             float * const y,
+                             const size_t n )
 {
-    float y;
-    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
-    qSSmoother_LPF1_t * const s = (qSSmoother_LPF1_t* const)f;
-    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
-    if ( 1u == f->init ) {
-        s->y1 = x;
-        f->init = 0u;
+    int retValue = 0;
+
+    if ( ( NULL != s ) && ( NULL != x ) && ( NULL != y ) ) {
+        /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+        _qSSmoother_t * const f = (_qSSmoother_t* const)s;
+        struct qSmoother_Vtbl_s *vt = f->vt;
+        /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+        if ( ( NULL != vt ) && ( NULL != vt->block ) ) {
+            if ( n > 0u ) {
+                vt->block( f, x, y, n );
+            }
+            retValue = 1;
+        }
     }
-    y = x + ( s->alpha*( s->y1 - x ) );
-    s->y1 = y;
 
-    return y;
+    return retValue;
 }
 /*============================================================================*/
-static float qSSmoother_Filter_LPF2( _qSSmoother_t *f,
-                                     const float x )
+static int32_t qSSmoother_GetIndex( const float * const a,
+                                    const int32_t i )
 {
-    float y;
-    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
-    qSSmoother_LPF2_t * const s = (qSSmoother_LPF2_t* const)f;
-    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
-    if ( 1u == f->init ) {
-        s->y1 = x;
-        s->y2 = x;
-        s->x1 = x;
-        s->x2 = x;
-        f->init = 0u;
-    }
-    y = ( s->k*x ) + ( s->b1*s->x1 ) + ( s->k*s->x2 )
-        - ( s->a1*s->y1 ) - ( s->a2*s->y2 );
-    s->x2 = s->x1;
-    s->x1 = x;
-    s->y2 = s->y1;
-    s->y1 = y;
+    int32_t v;
+    /*indexes are stored in the float area of the user*/
+    (void)memcpy( &v, &a[ i ], sizeof(int32_t) );
 
-    return y;
+    return v;
 }
 /*============================================================================*/
-static float qSSmoother_Filter_MWM1( _qSSmoother_t *f,
-                                     const float x )
+static void qSSmoother_SetIndex( float * const a,
+                                 const int32_t i,
+                                 const int32_t v )
 {
-    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
-    qSSmoother_MWM1_t * const s = (qSSmoother_MWM1_t* const)f;
-    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
-    if ( 1u == f->init ) {
-        qSSmoother_WindowSet( s->w, s->wsize, x );
-        f->init = 0u;
-    }
-    /*cstat -CERT-FLP36-C*/
-    return qLTISys_DiscreteFIRUpdate( s->w, NULL, s->wsize, x )/(float)s->wsize;
-    /*cstat +CERT-FLP36-C*/
+    (void)memcpy( &a[ i ], &v, sizeof(int32_t) );
 }
 /*============================================================================*/
-static float qSSmoother_Filter_MWM2( _qSSmoother_t *f,
-                                     const float x )
+static int qSSmoother_MednLess( const qSSmoother_MEDN_t * const s,
+                                const int32_t i,
+                                const int32_t j )
 {
-    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d -CERT-FLP36-C*/
-    qSSmoother_MWM2_t * const s = (qSSmoother_MWM2_t* const)f;
-    float wsize = (float)s->tdl.itemcount;
-    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d +CERT-FLP36-C*/
-    if ( 1u == f->init ) {
-        qTDL_Flush( &s->tdl, x );
-        s->sum = x*wsize;
-        f->init = 0u;
-    }
-    s->sum += x - qTDL_GetOldest( &s->tdl );
-    qTDL_InsertSample( &s->tdl, x );
+    return (int)( s->w[ qSSmoother_GetIndex( s->heap, i ) ] <
+                  s->w[ qSSmoother_GetIndex( s->heap, j ) ] );
+}
+/*============================================================================*/
+static int qSSmoother_MednExchange( const qSSmoother_MEDN_t * const s,
+                                    const int32_t i,
+                                    const int32_t j )
+{
+    const int32_t hi = qSSmoother_GetIndex( s->heap, i );
+    const int32_t hj = qSSmoother_GetIndex( s->heap, j );
 
-    return s->sum/wsize;
+    qSSmoother_SetIndex( s->heap, i, hj );
+    qSSmoother_SetIndex( s->heap, j, hi );
+    qSSmoother_SetIndex( s->pos, hj, i );
+    qSSmoother_SetIndex( s->pos, hi, j );
+
+    return 1;
 }
 /*============================================================================*/
-static float qSSmoother_Filter_MOR1( _qSSmoother_t *f,
-                                     const float x )
+static void qSSmoother_MednMinSortDown( const qSSmoother_MEDN_t * const s,
+                                        int32_t i )
 {
-    float m;
-    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
-    qSSmoother_MOR1_t * const s = (qSSmoother_MOR1_t* const)f;
-    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
-    if ( 1u == f->init ) {
-        qSSmoother_WindowSet( s->w, s->wsize, x );
-        s->m = x;
-        f->init = 0u;
+    /*cstat -MISRAC2012-Rule-10.8*/
+    const int32_t minCt = (int32_t)( ( s->wsize - 1u )/2u );
+    /*cstat +MISRAC2012-Rule-10.8*/
+
+    for ( i *= 2 ; i <= minCt ; i *= 2 ) {
+        if ( ( i < minCt ) && ( 0 != qSSmoother_MednLess( s, i + 1, i ) ) ) {
+            ++i;
+        }
+        if ( 0 == qSSmoother_MednLess( s, i, i/2 ) ) {
+            break;
+        }
+        (void)qSSmoother_MednExchange( s, i, i/2 );
     }
-    /*shift, sum and compensate*/
-    m = qLTISys_DiscreteFIRUpdate( s->w, NULL, s->wsize, x ) - x;
-    /*is it an outlier?*/
-    if ( qSSmoother_Abs( s->m - x ) > ( s->alpha*qSSmoother_Abs( s->m ) ) ) {
-        s->w[ 0 ] = s->m; /*replace the outlier with the dynamic median*/
+}
+/*============================================================================*/
+static void qSSmoother_MednMaxSortDown( const qSSmoother_MEDN_t * const s,
+                                        int32_t i )
+{
+    /*cstat -MISRAC2012-Rule-10.8*/
+    const int32_t maxCt = (int32_t)( s->wsize/2u );
+    /*cstat +MISRAC2012-Rule-10.8*/
+
+    for ( i *= 2 ; i >= -maxCt ; i *= 2 ) {
+        if ( ( i > -maxCt ) && ( 0 != qSSmoother_MednLess( s, i, i - 1 ) ) ) {
+            --i;
+        }
+        if ( 0 == qSSmoother_MednLess( s, i/2, i ) ) {
+            break;
+        }
+        (void)qSSmoother_MednExchange( s, i/2, i );
     }
-    /*cstat -CERT-FLP36-C*/
-    /*compute new mean for next iteration*/
-    s->m = ( m + s->w[ 0 ] ) / (float)s->wsize;
-    /*cstat +CERT-FLP36-C*/
-    return s->w[ 0 ];
 }
 /*============================================================================*/
-static float qSSmoother_Filter_MOR2( _qSSmoother_t *f,
-                                     const float x )
+static int qSSmoother_MednMinSortUp( const qSSmoother_MEDN_t * const s,
+                                     int32_t i )
 {
-    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d -CERT-FLP36-C*/
-    qSSmoother_MOR2_t * const s = (qSSmoother_MOR2_t* const)f;
-    float wsize = (float)s->tdl.itemcount;
-    float xx = x;
-    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d +CERT-FLP36-C*/
-    if ( 1u == f->init ) {
-        qTDL_Flush( &s->tdl, x );
-        s->sum = wsize*x;
-        s->m = x;
-        f->init = 0u;
+    while ( ( i > 0 ) && ( 0 != qSSmoother_MednLess( s, i, i/2 ) ) ) {
+        (void)qSSmoother_MednExchange( s, i, i/2 );
+        i /= 2;
     }
-    /*is it an outlier?*/
-    if ( qSSmoother_Abs( s->m - x ) > ( s->alpha*qSSmoother_Abs( s->m ) ) ) {
-        xx = s->m; /*replace the outlier with the dynamic median*/
+
+    return (int)( 0 == i ); /*the median changed*/
+}
+/*============================================================================*/
+static int qSSmoother_MednMaxSortUp( const qSSmoother_MEDN_t * const s,
+                                     int32_t i )
+{
+    /*parent of a negative index, C division truncates toward zero*/
+    while ( ( i < 0 ) && ( 0 != qSSmoother_MednLess( s, i/2, i ) ) ) {
+        (void)qSSmoother_MednExchange( s, i/2, i );
+        i /= 2;
     }
-    s->sum += xx - qTDL_GetOldest( &s->tdl );
-    s->m = s->sum/wsize;
-    qTDL_InsertSample( &s->tdl, xx );
 
-    return x;
+    return (int)( 0 == i ); /*the median changed*/
 }
 /*============================================================================*/
-static float qSSmoother_Filter_GMWF( _qSSmoother_t *f,
-                                     const float x )
+static void qSSmoother_MednInsert( qSSmoother_MEDN_t * const s,
+                                   const float x )
 {
-    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
-    qSSmoother_GMWF_t * const s = (qSSmoother_GMWF_t* const)f;
-    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    /*cstat -MISRAC2012-Rule-10.8*/
+    const int32_t k = (int32_t)s->idx;
+    /*cstat +MISRAC2012-Rule-10.8*/
+    const int32_t p = qSSmoother_GetIndex( s->pos, k );
+    const float old = s->w[ k ];
 
-    if ( 1u == f->init ) {
-        qSSmoother_WindowSet( s->w, s->wsize, x );
-        f->init = 0u;
+    /*the new sample takes the place of the oldest one in the heaps*/
+    s->w[ k ] = x;
+    if ( ++s->idx >= s->wsize ) {
+        s->idx = 0u;
+    }
+    if ( p > 0 ) { /*in the min-heap*/
+        if ( old < x ) {
+            qSSmoother_MednMinSortDown( s, p );
+        }
+        else if ( ( 0 != qSSmoother_MednMinSortUp( s, p ) ) &&
+                  ( 0 != qSSmoother_MednLess( s, 0, -1 ) ) ) {
+            /*the new median may belong to the max-heap*/
+            (void)qSSmoother_MednExchange( s, 0, -1 );
+            qSSmoother_MednMaxSortDown( s, -1 );
+        }
+        else {
+            /*nothing to do*/
+        }
+    }
+    else if ( p < 0 ) { /*in the max-heap*/
+        if ( x < old ) {
+            qSSmoother_MednMaxSortDown( s, p );
+        }
+        else if ( ( 0 != qSSmoother_MednMaxSortUp( s, p ) ) && ( s->wsize > 2u ) &&
+                  ( 0 != qSSmoother_MednLess( s, 1, 0 ) ) ) {
+            /*the new median may belong to the min-heap*/
+            (void)qSSmoother_MednExchange( s, 1, 0 );
+            qSSmoother_MednMinSortDown( s, 1 );
+        }
+        else {
+            /*nothing to do*/
+        }
+    }
+    else { /*at the median*/
+        if ( ( s->wsize > 1u ) && ( 0 != qSSmoother_MednMaxSortUp( s, -1 ) ) ) {
+            qSSmoother_MednMaxSortDown( s, -1 );
+        }
+        if ( ( s->wsize > 2u ) && ( 0 != qSSmoother_MednMinSortUp( s, 1 ) ) ) {
+            qSSmoother_MednMinSortDown( s, 1 );
+        }
     }
-    return qLTISys_DiscreteFIRUpdate( s->w, s->k, s->wsize, x );
 }
 /*============================================================================*/
-static float qSSmoother_Filter_KLMN( _qSSmoother_t *f,
-                                     const float x )
+static float qSSmoother_MednGet( const qSSmoother_MEDN_t * const s )
 {
-    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
-    qSSmoother_KLMN_t * const s = (qSSmoother_KLMN_t* const)f;
-    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
-    float pH;
-    if ( 1u == f->init ) {
-        s->x = x;
-        f->init = 0u;
+    float m = s->w[ qSSmoother_GetIndex( s->heap, 0 ) ];
+
+    /*for even windows, average with the top of the max-heap*/
+    if ( 0u == ( s->wsize & 1u ) ) {
+        m = 0.5f*( m + s->w[ qSSmoother_GetIndex( s->heap, -1 ) ] );
     }
-    /* Predict */
-    s->x = s->A*s->x;
-    s->p = ( s->A*s->A*s->p ) + s->q; /* p(n|n-1)=A^2*p(n-1|n-1)+q */
-    /* Measurement */
-    pH = s->p*s->H;
-    s->gain =  pH/( s->r + ( s->H*pH ) );
-    s->x += s->gain*( x - ( s->H*s->x ) );
-    s->p = ( 1.0f - ( s->gain*s->H ) )*s->p;
 
-    return s->x;
+    return m;
 }
 /*============================================================================*/
-static float qSSmoother_Filter_EXPW( _qSSmoother_t *f,
+static float qSSmoother_Filter_MEDN( _qSSmoother_t *f,
                                      const float x )
 {
     /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
-    qSSmoother_EXPW_t * const s = (qSSmoother_EXPW_t* const)f;
+    qSSmoother_MEDN_t * const s = (qSSmoother_MEDN_t* const)f;
     /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
-    float iw;
 
     if ( 1u == f->init ) {
-        s->m = x;
-        s->w = 1.0f;
+        size_t i;
+        /*fill pattern: median, max, min, max, min... all with the same value,
+        so both heaps are valid from the start*/
+        for ( i = 0u ; i < s->wsize ; ++i ) {
+            /*cstat -MISRAC2012-Rule-10.8*/
+            const int32_t k = (int32_t)i;
+            const int32_t p = ( ( k + 1 )/2 )*( ( 0 != ( k & 1 ) )? -1 : 1 );
+            /*cstat +MISRAC2012-Rule-10.8*/
+            s->w[ i ] = x;
+            qSSmoother_SetIndex( s->pos, k, p );
+            qSSmoother_SetIndex( s->heap, p, k );
+        }
+        s->idx = 0u;
         f->init = 0u;
     }
-    s->w = ( s->lambda*s->w ) + 1.0f;
-    iw = 1.0f/s->w;
-    s->m = ( s->m*( 1.0f - iw ) ) + ( iw*x );
+    qSSmoother_MednInsert( s, x );
 
-    return s->m;
+    return qSSmoother_MednGet( s );
+}
+/*============================================================================*/
+static int32_t qSSmoother_HmplGet( const qSSmoother_HMPL_t * const s,
+                                   const int32_t node,
+                                   const int32_t field )
+{
+    return qSSmoother_GetIndex( s->t, ( node*QSSMOOTHER_HMPL_FIELDS ) + field );
+}
+/*============================================================================*/
+static void qSSmoother_HmplSet( const qSSmoother_HMPL_t * const s,
+                                const int32_t node,
+                                const int32_t field,
+                                const int32_t v )
+{
+    qSSmoother_SetIndex( s->t, ( node*QSSMOOTHER_HMPL_FIELDS ) + field, v );
+}
+/*============================================================================*/
+static int32_t qSSmoother_HmplSize( const qSSmoother_HMPL_t * const s,
+                                    const int32_t node )
+{
+    return ( node < 0 )? 0 : qSSmoother_HmplGet( s, node, QSSMOOTHER_HMPL_SIZE );
+}
+/*============================================================================*/
+static int qSSmoother_HmplBefore( const qSSmoother_HMPL_t * const s,
+                                  const int32_t i,
+                                  const int32_t j )
+{
+    /*ties are broken by the node index, so every key is unique*/
+    return (int)( ( s->w[ i ] < s->w[ j ] ) ||
+                  ( ( s->w[ i ] == s->w[ j ] ) && ( i < j ) ) );
+}
+/*============================================================================*/
+static void qSSmoother_HmplRotateUp( qSSmoother_HMPL_t * const s,
+                                     const int32_t x )
+{
+    const int32_t p = qSSmoother_HmplGet( s, x, QSSMOOTHER_HMPL_PARENT );
+    const int32_t g = qSSmoother_HmplGet( s, p, QSSMOOTHER_HMPL_PARENT );
+    int32_t b, l, r;
+
+    if ( x == qSSmoother_HmplGet( s, p, QSSMOOTHER_HMPL_LEFT ) ) {
+        b = qSSmoother_HmplGet( s, x, QSSMOOTHER_HMPL_RIGHT );
+        qSSmoother_HmplSet( s, p, QSSMOOTHER_HMPL_LEFT, b );
+        qSSmoother_HmplSet( s, x, QSSMOOTHER_HMPL_RIGHT, p );
+    }
+    else {
+        b = qSSmoother_HmplGet( s, x, QSSMOOTHER_HMPL_LEFT );
+        qSSmoother_HmplSet( s, p, QSSMOOTHER_HMPL_RIGHT, b );
+        qSSmoother_HmplSet( s, x, QSSMOOTHER_HMPL_LEFT, p );
+    }
+    if ( b >= 0 ) {
+        qSSmoother_HmplSet( s, b, QSSMOOTHER_HMPL_PARENT, p );
+    }
+    qSSmoother_HmplSet( s, p, QSSMOOTHER_HMPL_PARENT, x );
+    qSSmoother_HmplSet( s, x, QSSMOOTHER_HMPL_PARENT, g );
+    if ( g < 0 ) {
+        s->root = x;
+    }
+    else if ( p == qSSmoother_HmplGet( s, g, QSSMOOTHER_HMPL_LEFT ) ) {
+        qSSmoother_HmplSet( s, g, QSSMOOTHER_HMPL_LEFT, x );
+    }
+    else {
+        qSSmoother_HmplSet( s, g, QSSMOOTHER_HMPL_RIGHT, x );
+    }
+    /*x takes the place of p, so it gets its size*/
+    qSSmoother_HmplSet( s, x, QSSMOOTHER_HMPL_SIZE,
+                        qSSmoother_HmplGet( s, p, QSSMOOTHER_HMPL_SIZE ) );
+    l = qSSmoother_HmplSize( s, qSSmoother_HmplGet( s, p, QSSMOOTHER_HMPL_LEFT ) );
+    r = qSSmoother_HmplSize( s, qSSmoother_HmplGet( s, p, QSSMOOTHER_HMPL_RIGHT ) );
+    qSSmoother_HmplSet( s, p, QSSMOOTHER_HMPL_SIZE, l + r + 1 );
+}
+/*============================================================================*/
+static void qSSmoother_HmplLink( qSSmoother_HMPL_t * const s,
+                                 const int32_t k )
+{
+    int32_t p = -1;
+    int32_t c = s->root;
+
+    /*xorshift32, the random priorities keep the tree balanced*/
+    s->seed ^= s->seed << 13;
+    s->seed ^= s->seed >> 17;
+    s->seed ^= s->seed << 5;
+    qSSmoother_HmplSet( s, k, QSSMOOTHER_HMPL_PRIORITY, (int32_t)( s->seed >> 1 ) );
+    qSSmoother_HmplSet( s, k, QSSMOOTHER_HMPL_LEFT, -1 );
+    qSSmoother_HmplSet( s, k, QSSMOOTHER_HMPL_RIGHT, -1 );
+    qSSmoother_HmplSet( s, k, QSSMOOTHER_HMPL_SIZE, 1 );
+    /*insert as a leaf, every node in the path gets one more descendant*/
+    while ( c >= 0 ) {
+        p = c;
+        qSSmoother_HmplSet( s, c, QSSMOOTHER_HMPL_SIZE,
+                            qSSmoother_HmplGet( s, c, QSSMOOTHER_HMPL_SIZE ) + 1 );
+        if ( 0 != qSSmoother_HmplBefore( s, k, c ) ) {
+            c = qSSmoother_HmplGet( s, c, QSSMOOTHER_HMPL_LEFT );
+        }
+        else {
+            c = qSSmoother_HmplGet( s, c, QSSMOOTHER_HMPL_RIGHT );
+        }
+    }
+    qSSmoother_HmplSet( s, k, QSSMOOTHER_HMPL_PARENT, p );
+    if ( p < 0 ) {
+        s->root = k;
+    }
+    else if ( 0 != qSSmoother_HmplBefore( s, k, p ) ) {
+        qSSmoother_HmplSet( s, p, QSSMOOTHER_HMPL_LEFT, k );
+    }
+    else {
+        qSSmoother_HmplSet( s, p, QSSMOOTHER_HMPL_RIGHT, k );
+    }
+    /*then rotate it up to restore the heap order of the priorities*/
+    for ( p = qSSmoother_HmplGet( s, k, QSSMOOTHER_HMPL_PARENT ) ;
+          ( p >= 0 ) && ( qSSmoother_HmplGet( s, k, QSSMOOTHER_HMPL_PRIORITY ) >
+                          qSSmoother_HmplGet( s, p, QSSMOOTHER_HMPL_PRIORITY ) ) ;
+          p = qSSmoother_HmplGet( s, k, QSSMOOTHER_HMPL_PARENT ) ) {
+        qSSmoother_HmplRotateUp( s, k );
+    }
+}
+/*============================================================================*/
+static void qSSmoother_HmplUnlink( qSSmoother_HMPL_t * const s,
+                                   const int32_t k )
+{
+    int32_t l = qSSmoother_HmplGet( s, k, QSSMOOTHER_HMPL_LEFT );
+    int32_t r = qSSmoother_HmplGet( s, k, QSSMOOTHER_HMPL_RIGHT );
+    int32_t p;
+
+    /*rotate the node down until it becomes a leaf*/
+    while ( ( l >= 0 ) || ( r >= 0 ) ) {
+        if ( ( r < 0 ) || ( ( l >= 0 ) &&
+             ( qSSmoother_HmplGet( s, l, QSSMOOTHER_HMPL_PRIORITY ) >
+               qSSmoother_HmplGet( s, r, QSSMOOTHER_HMPL_PRIORITY ) ) ) ) {
+            qSSmoother_HmplRotateUp( s, l );
+        }
+        else {
+            qSSmoother_HmplRotateUp( s, r );
+        }
+        l = qSSmoother_HmplGet( s, k, QSSMOOTHER_HMPL_LEFT );
+        r = qSSmoother_HmplGet( s, k, QSSMOOTHER_HMPL_RIGHT );
+    }
+    p = qSSmoother_HmplGet( s, k, QSSMOOTHER_HMPL_PARENT );
+    if ( p < 0 ) {
+        s->root = -1;
+    }
+    else {
+        if ( k == qSSmoother_HmplGet( s, p, QSSMOOTHER_HMPL_LEFT ) ) {
+            qSSmoother_HmplSet( s, p, QSSMOOTHER_HMPL_LEFT, -1 );
+        }
+        else {
+            qSSmoother_HmplSet( s, p, QSSMOOTHER_HMPL_RIGHT, -1 );
+        }
+        for ( ; p >= 0 ; p = qSSmoother_HmplGet( s, p, QSSMOOTHER_HMPL_PARENT ) ) {
+            qSSmoother_HmplSet( s, p, QSSMOOTHER_HMPL_SIZE,
+                                qSSmoother_HmplGet( s, p, QSSMOOTHER_HMPL_SIZE ) - 1 );
+        }
+    }
+}
+/*============================================================================*/
+static float qSSmoother_HmplSelect( const qSSmoother_HMPL_t * const s,
+                                    int32_t r )
+{
+    int32_t c = s->root;
+    int32_t ls = qSSmoother_HmplSize( s, qSSmoother_HmplGet( s, c, QSSMOOTHER_HMPL_LEFT ) );
+
+    /*find the sample with r samples below it*/
+    while ( r != ls ) {
+        if ( r < ls ) {
+            c = qSSmoother_HmplGet( s, c, QSSMOOTHER_HMPL_LEFT );
+        }
+        else {
+            r -= ls + 1;
+            c = qSSmoother_HmplGet( s, c, QSSMOOTHER_HMPL_RIGHT );
+        }
+        ls = qSSmoother_HmplSize( s, qSSmoother_HmplGet( s, c, QSSMOOTHER_HMPL_LEFT ) );
+    }
+
+    return s->w[ c ];
+}
+/*============================================================================*/
+static float qSSmoother_HmplDeviation( const qSSmoother_HMPL_t * const s,
+                                       const float m,
+                                       const int32_t k )
+{
+    /*cstat -MISRAC2012-Rule-10.8*/
+    const int32_t n = (int32_t)s->wsize;
+    /*cstat +MISRAC2012-Rule-10.8*/
+    const int32_t c = n/2;
+    int32_t lo = ( ( k + 1 - ( n - c ) ) > 0 )? ( k + 1 - ( n - c ) ) : 0;
+    int32_t hi = ( ( k + 1 ) < c )? ( k + 1 ) : c;
+    float d = 0.0f;
+
+    /*the absolute deviations are two sorted sequences, m - x(c-1-i) below
+    the median and x(c+j) - m above it. Find how many of the k+1 smallest
+    deviations come from below the median*/
+    while ( lo < hi ) {
+        const int32_t i = lo + ( ( hi - lo )/2 );
+        const int32_t j = k + 1 - i;
+
+        if ( ( m - qSSmoother_HmplSelect( s, c - 1 - i ) ) <
+             ( qSSmoother_HmplSelect( s, c + j - 1 ) - m ) ) {
+            lo = i + 1;
+        }
+        else {
+            hi = i;
+        }
+    }
+    /*the k-th deviation is the largest of the ones taken*/
+    if ( lo > 0 ) {
+        d = m - qSSmoother_HmplSelect( s, c - lo );
+    }
+    if ( ( k + 1 - lo ) > 0 ) {
+        const float u = qSSmoother_HmplSelect( s, c + k - lo ) - m;
+
+        d = ( u > d )? u : d;
+    }
+
+    return d;
+}
+/*============================================================================*/
+static float qSSmoother_HmplUpdate( qSSmoother_HMPL_t * const s,
+                                    const float x )
+{
+    /*cstat -MISRAC2012-Rule-10.8*/
+    const int32_t n = (int32_t)s->wsize;
+    const int32_t k = (int32_t)s->idx;
+    /*cstat +MISRAC2012-Rule-10.8*/
+    float m = qSSmoother_HmplSelect( s, n/2 );
+    float mad;
+    float y = x;
+
+    if ( 0 == ( n & 1 ) ) {
+        m = 0.5f*( m + qSSmoother_HmplSelect( s, ( n/2 ) - 1 ) );
+        mad = 0.5f*( qSSmoother_HmplDeviation( s, m, ( n/2 ) - 1 ) +
+                     qSSmoother_HmplDeviation( s, m, n/2 ) );
+    }
+    else {
+        mad = qSSmoother_HmplDeviation( s, m, n/2 );
+    }
+    /*is it an outlier?*/
+    if ( qSSmoother_Abs( x - m ) > ( s->k*mad ) ) {
+        y = m; /*replace the outlier with the median*/
+    }
+    /*the window keeps the raw sample in place of the oldest one*/
+    qSSmoother_HmplUnlink( s, k );
+    s->w[ k ] = x;
+    qSSmoother_HmplLink( s, k );
+    if ( ++s->idx >= s->wsize ) {
+        s->idx = 0u;
+    }
+
+    return y;
+}
+/*============================================================================*/
+static float qSSmoother_Filter_HMPL( _qSSmoother_t *f,
+                                     const float x )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_HMPL_t * const s = (qSSmoother_HMPL_t* const)f;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+
+    if ( 1u == f->init ) {
+        size_t i;
+
+        s->root = -1;
+        s->seed = 0x9E3779B9uL;
+        for ( i = 0u ; i < s->wsize ; ++i ) {
+            s->w[ i ] = x;
+            /*cstat -MISRAC2012-Rule-10.8*/
+            qSSmoother_HmplLink( s, (int32_t)i );
+            /*cstat +MISRAC2012-Rule-10.8*/
+        }
+        s->idx = 0u;
+        f->init = 0u;
+    }
+
+    return qSSmoother_HmplUpdate( s, x );
+}
+/*============================================================================*/
+static float qSSmoother_MmaxPush( float * const q,
+                                  const size_t n,
+                                  size_t * const head,
+                                  size_t * const count,
+                                  const uint32_t t,
+                                  const float x )
+{
+    size_t h = *head;
+    size_t c = *count;
+    size_t back;
+
+    if ( c > 0u ) {
+        uint32_t tf;
+        /*the front leaves the window, only one sample can expire at a time*/
+        (void)memcpy( &tf, &q[ ( 2u*h ) + 1u ], sizeof(uint32_t) );
+        if ( (size_t)( t - tf ) >= n ) {
+            h = ( ( h + 1u ) < n )? ( h + 1u ) : 0u;
+            --c;
+        }
+    }
+    /*samples dominated by the new one can never be the maximum again*/
+    for ( ; c > 0u ; --c ) {
+        back = h + c - 1u;
+        back = ( back < n )? back : ( back - n );
+        if ( q[ 2u*back ] > x ) {
+            break;
+        }
+    }
+    back = h + c;
+    back = ( back < n )? back : ( back - n );
+    q[ 2u*back ] = x;
+    (void)memcpy( &q[ ( 2u*back ) + 1u ], &t, sizeof(uint32_t) );
+    *head = h;
+    *count = c + 1u;
+
+    return q[ 2u*h ];
+}
+/*============================================================================*/
+static float qSSmoother_MmaxUpdate( qSSmoother_MMAX_t * const s,
+                                    const float x )
+{
+    float y;
+
+    s->max = qSSmoother_MmaxPush( s->q, s->wsize, &s->hMax, &s->nMax, s->t, x );
+    /*the min-deque is a max-deque of the negated samples*/
+    s->min = -qSSmoother_MmaxPush( &s->q[ 2u*s->wsize ], s->wsize, &s->hMin,
+                                   &s->nMin, s->t, -x );
+    ++s->t;
+    if ( 0u == s->out ) {
+        y = s->min;
+    }
+    else if ( 1u == s->out ) {
+        y = s->max;
+    }
+    else {
+        y = s->max - s->min;
+    }
+
+    return y;
+}
+/*============================================================================*/
+static float qSSmoother_Filter_MMAX( _qSSmoother_t *f,
+                                     const float x )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_MMAX_t * const s = (qSSmoother_MMAX_t* const)f;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+
+    if ( 1u == f->init ) {
+        /*a window full of x has x as its only candidate*/
+        s->hMax = 0u;
+        s->nMax = 0u;
+        s->hMin = 0u;
+        s->nMin = 0u;
+        s->t = 0u;
+        f->init = 0u;
+    }
+
+    return qSSmoother_MmaxUpdate( s, x );
+}
+/*============================================================================*/
+int qSSmoother_GMWF_SetFFT( qSSmoother_GMWF_t * const s,
+                            float * const area,
+                            const size_t nfft )
+{
+    int retValue = 0;
+
+    if ( ( NULL != s ) && ( 1 == qSSmoother_IsInitialized( s ) ) ) {
+        retValue = qLTISys_FFTConv_Setup( &s->fft, area, nfft, s->k, s->wsize );
+        if ( 0 == retValue ) {
+            s->fft.h = NULL;
+        }
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+int qSSmoother_MMAX_GetEnvelope( const qSSmoother_MMAX_t * const s,
+                                 float * const min,
+                                 float * const max )
+{
+    int retValue = 0;
+
+    if ( ( NULL != s ) && ( 0u == s->f.init ) ) {
+        if ( NULL != min ) {
+            *min = s->min;
+        }
+        if ( NULL != max ) {
+            *max = s->max;
+        }
+        retValue = 1;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+int qSSmoother_MMAX_PerformFrame( qSSmoother_MMAX_t * const s,
+                                  const size_t nc,
+                                  const float * const x,
+                                  float * const y )
+{
+    int retValue = 0;
+
+    if ( ( NULL != s ) && ( NULL != x ) && ( NULL != y ) ) {
+        size_t i;
+
+        for ( i = 0u ; i < nc ; ++i ) {
+            y[ i ] = qSSmoother_Filter_MMAX( &s[ i ].f, x[ i ] );
+        }
+        retValue = 1;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static size_t qSSmoother_SosCheck( const float * const c )
+{
+    size_t ns = 0u;
+
+    if ( ( NULL != c ) && ( c[ 0 ] >= 1.0f ) && ( c[ 0 ] < 65536.0f ) ) {
+        const size_t n = (size_t)c[ 0 ];
+        size_t k;
+
+        if ( (float)n == c[ 0 ] ) {
+            ns = n;
+            for ( k = 0u ; k < n ; ++k ) {
+                const float a1 = c[ 5u*k + 4u ];
+                const float a2 = c[ 5u*k + 5u ];
+                /*the poles of the section lie inside the unit circle*/
+                if ( ( qSSmoother_Abs( a2 ) >= 1.0f ) ||
+                     ( qSSmoother_Abs( a1 ) >= ( 1.0f + a2 ) ) ) {
+                    ns = 0u;
+                    break;
+                }
+            }
+        }
+    }
+
+    return ns;
+}
+/*============================================================================*/
+static void qSSmoother_SosSeed( const float * const c,
+                                float * const d,
+                                const size_t ns,
+                                const size_t stride,
+                                const float x )
+{
+    float u = x;
+    size_t k;
+
+    /*set the delays to the steady state of a constant input x*/
+    for ( k = 0u ; k < ns ; ++k ) {
+        const float * const ck = &c[ 5u*k ];
+        const float v = u*( ( ck[ 0 ] + ck[ 1 ] + ck[ 2 ] )/( 1.0f + ck[ 3 ] + ck[ 4 ] ) );
+
+        d[ 2u*k*stride ] = v - ( ck[ 0 ]*u );
+        d[ ( ( 2u*k ) + 1u )*stride ] = ( ck[ 2 ]*u ) - ( ck[ 4 ]*v );
+        u = v;
+    }
+}
+/*============================================================================*/
+static float qSSmoother_Filter_SOS( _qSSmoother_t *f,
+                                    const float x )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_SOS_t * const s = (qSSmoother_SOS_t* const)f;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    float u = x;
+    size_t k;
+
+    if ( 1u == f->init ) {
+        qSSmoother_SosSeed( s->c, s->d, s->ns, 1u, x );
+        f->init = 0u;
+    }
+    for ( k = 0u ; k < s->ns ; ++k ) {
+        const float * const c = &s->c[ 5u*k ];
+        float * const d = &s->d[ 2u*k ];
+        const float v = ( c[ 0 ]*u ) + d[ 0 ];
+
+        d[ 0 ] = ( ( c[ 1 ]*u ) + d[ 1 ] ) - ( c[ 3 ]*v );
+        d[ 1 ] = ( c[ 2 ]*u ) - ( c[ 4 ]*v );
+        u = v;
+    }
+
+    return u;
+}
+/*============================================================================*/
+static qSSmoother_Complex_t qSSmoother_CMul( const qSSmoother_Complex_t a,
+                                             const qSSmoother_Complex_t b )
+{
+    qSSmoother_Complex_t z;
+
+    z.r = ( a.r*b.r ) - ( a.i*b.i );
+    z.i = ( a.r*b.i ) + ( a.i*b.r );
+
+    return z;
+}
+/*============================================================================*/
+static qSSmoother_Complex_t qSSmoother_CDiv( const qSSmoother_Complex_t a,
+                                             const qSSmoother_Complex_t b )
+{
+    const double m = ( b.r*b.r ) + ( b.i*b.i );
+    qSSmoother_Complex_t z;
+
+    z.r = ( ( a.r*b.r ) + ( a.i*b.i ) )/m;
+    z.i = ( ( a.i*b.r ) - ( a.r*b.i ) )/m;
+
+    return z;
+}
+/*============================================================================*/
+static qSSmoother_Complex_t qSSmoother_CSqrt( const qSSmoother_Complex_t a )
+{
+    const double m = sqrt( ( a.r*a.r ) + ( a.i*a.i ) );
+    qSSmoother_Complex_t z;
+
+    z.r = sqrt( 0.5*( m + a.r ) );
+    z.i = sqrt( 0.5*( m - a.r ) );
+    if ( a.i < 0.0 ) {
+        z.i = -z.i;
+    }
+
+    return z;
+}
+/*============================================================================*/
+static qSSmoother_Complex_t qSSmoother_Bilinear( const qSSmoother_Complex_t s )
+{
+    qSSmoother_Complex_t n, d;
+
+    /*z = ( 2 + s )/( 2 - s ), with the frequencies normalized to fs = 1*/
+    n.r = 2.0 + s.r;
+    n.i = s.i;
+    d.r = 2.0 - s.r;
+    d.i = -s.i;
+
+    return qSSmoother_CDiv( n, d );
+}
+/*============================================================================*/
+static void qSSmoother_SosSection( float * const c,
+                                   const qSSmoother_Complex_t p1,
+                                   const qSSmoother_Complex_t p2,
+                                   const double b1,
+                                   const double b2,
+                                   const qSSmoother_Complex_t zr )
+{
+    const double a1 = -( p1.r + p2.r );
+    const double a2 = qSSmoother_CMul( p1, p2 ).r;
+    qSSmoother_Complex_t w, w2, num, den;
+    double g;
+
+    /*normalize the section to unity gain at the reference point zr, that
+    lies on the unit circle, so 1/zr is its conjugate*/
+    w.r = zr.r;
+    w.i = -zr.i;
+    w2 = qSSmoother_CMul( w, w );
+    num.r = 1.0 + ( b1*w.r ) + ( b2*w2.r );
+    num.i = ( b1*w.i ) + ( b2*w2.i );
+    den.r = 1.0 + ( a1*w.r ) + ( a2*w2.r );
+    den.i = ( a1*w.i ) + ( a2*w2.i );
+    g = sqrt( ( ( den.r*den.r ) + ( den.i*den.i ) )/
+              ( ( num.r*num.r ) + ( num.i*num.i ) ) );
+    c[ 0 ] = (float)g;
+    c[ 1 ] = (float)( g*b1 );
+    c[ 2 ] = (float)( g*b2 );
+    c[ 3 ] = (float)a1;
+    c[ 4 ] = (float)a2;
+}
+/*============================================================================*/
+int qSSmoother_SOS_Design( float * const c,
+                           const qSSmoother_SOS_Proto_t proto,
+                           const qSSmoother_SOS_Band_t band,
+                           const size_t order,
+                           const float f1,
+                           const float f2,
+                           const float ripple )
+{
+    int retValue = 0;
+    const int bandEdges = (int)( ( QSSMOOTHER_SOS_BANDPASS == band ) ||
+                                 ( QSSMOOTHER_SOS_BANDSTOP == band ) );
+
+    if ( ( NULL != c ) && ( order > 0u ) && ( order < 65536u ) &&
+         ( f1 > 0.0f ) && ( f1 < 0.5f ) &&
+         ( ( 0 == bandEdges ) || ( ( f2 > f1 ) && ( f2 < 0.5f ) ) ) &&
+         ( ( QSSMOOTHER_SOS_BUTTERWORTH == proto ) ||
+           ( ( QSSMOOTHER_SOS_CHEBYSHEV1 == proto ) && ( ripple > 0.0f ) ) ) &&
+         ( (int)band >= (int)QSSMOOTHER_SOS_LOWPASS ) &&
+         ( (int)band <= (int)QSSMOOTHER_SOS_BANDSTOP ) ) {
+        const double pi = 3.141592653589793;
+        /*pre-warped analog band edges*/
+        const double w1 = 2.0*tan( pi*(double)f1 );
+        const double w2 = ( 0 != bandEdges )? 2.0*tan( pi*(double)f2 ) : w1;
+        const double ww = w1*w2; /*squared center frequency*/
+        const double hbw = 0.5*( w2 - w1 );
+        double sr = 1.0, si = 1.0, g0 = 1.0, b1, b2;
+        qSSmoother_Complex_t zr = { 1.0, 0.0 };
+        qSSmoother_Complex_t origin = { 0.0, 0.0 };
+        qSSmoother_Complex_t center = { 0.0, 0.0 };
+        size_t k, ns = 0u;
+
+        if ( QSSMOOTHER_SOS_CHEBYSHEV1 == proto ) {
+            const double e2 = pow( 10.0, 0.1*(double)ripple ) - 1.0;
+            const double mu = asinh( 1.0/sqrt( e2 ) )/(double)order;
+
+            sr = sinh( mu );
+            si = cosh( mu );
+            if ( 0u == ( order & 1u ) ) {
+                /*an even order starts at the bottom of the ripple*/
+                g0 = 1.0/sqrt( 1.0 + e2 );
+            }
+        }
+        center.i = sqrt( ww );
+        if ( QSSMOOTHER_SOS_LOWPASS == band ) {
+            b1 = 2.0; /*zeros at z = -1*/
+            b2 = 1.0;
+        }
+        else if ( QSSMOOTHER_SOS_HIGHPASS == band ) {
+            b1 = -2.0; /*zeros at z = 1*/
+            b2 = 1.0;
+            zr.r = -1.0;
+        }
+        else if ( QSSMOOTHER_SOS_BANDPASS == band ) {
+            b1 = 0.0; /*zeros at z = 1 and z = -1*/
+            b2 = -1.0;
+            zr = qSSmoother_Bilinear( center );
+        }
+        else {
+            b1 = -2.0*qSSmoother_Bilinear( center ).r; /*zeros at the center*/
+            b2 = 1.0;
+        }
+        for ( k = 0u ; k < ( ( order + 1u )/2u ) ; ++k ) {
+            /*poles of the analog prototype with cutoff 1 rad/s on the upper
+            half plane, the last one is real if the order is odd*/
+            const double th = ( pi*(double)( ( 2u*k ) + 1u ) )/( 2.0*(double)order );
+            const int real = (int)( ( ( 2u*k ) + 1u ) == order );
+            qSSmoother_Complex_t p, q;
+
+            p.r = -sr*sin( th );
+            p.i = ( 0 != real )? 0.0 : ( si*cos( th ) );
+            if ( QSSMOOTHER_SOS_LOWPASS == band ) {
+                p.r *= w1;
+                p.i *= w1;
+            }
+            else {
+                q.r = ( QSSMOOTHER_SOS_HIGHPASS == band )? w1 : hbw;
+                q.i = 0.0;
+                p = ( QSSMOOTHER_SOS_BANDPASS == band )? qSSmoother_CMul( p, q ) : qSSmoother_CDiv( q, p );
+            }
+            if ( 0 == bandEdges ) {
+                p = qSSmoother_Bilinear( p );
+                if ( 0 != real ) {
+                    /*first-order section*/
+                    qSSmoother_SosSection( &c[ 1u + ( 5u*ns ) ], p, origin, 0.5*b1, 0.0, zr );
+                }
+                else {
+                    q.r = p.r;
+                    q.i = -p.i;
+                    qSSmoother_SosSection( &c[ 1u + ( 5u*ns ) ], p, q, b1, b2, zr );
+                }
+                ++ns;
+            }
+            else {
+                /*each pole maps to the two roots of s^2 - 2*p*s + w0^2 = 0*/
+                qSSmoother_Complex_t r, s1, s2;
+
+                r = qSSmoother_CMul( p, p );
+                r.r -= ww;
+                r = qSSmoother_CSqrt( r );
+                s1.r = p.r + r.r;
+                s1.i = p.i + r.i;
+                s2.r = p.r - r.r;
+                s2.i = p.i - r.i;
+                s1 = qSSmoother_Bilinear( s1 );
+                s2 = qSSmoother_Bilinear( s2 );
+                if ( 0 != real ) {
+                    qSSmoother_SosSection( &c[ 1u + ( 5u*ns ) ], s1, s2, b1, b2, zr );
+                    ++ns;
+                }
+                else {
+                    q.r = s1.r;
+                    q.i = -s1.i;
+                    qSSmoother_SosSection( &c[ 1u + ( 5u*ns ) ], s1, q, b1, b2, zr );
+                    q.r = s2.r;
+                    q.i = -s2.i;
+                    qSSmoother_SosSection( &c[ 6u + ( 5u*ns ) ], s2, q, b1, b2, zr );
+                    ns += 2u;
+                }
+            }
+        }
+        c[ 0 ] = (float)ns;
+        c[ 1 ] = (float)( g0*(double)c[ 1 ] );
+        c[ 2 ] = (float)( g0*(double)c[ 2 ] );
+        c[ 3 ] = (float)( g0*(double)c[ 3 ] );
+        retValue = 1;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+int qSSmoother_SOS_SetAccel( qSSmoother_SOS_t * const s,
+                             const uint8_t enable )
+{
+    int retValue = 0;
+
+    if ( NULL != s ) {
+        s->simd = ( 0u != enable )? qSIMD_Select() : QSIMD_NONE;
+        retValue = ( ( 0u == enable ) || ( QSIMD_NONE != s->simd ) )? 1 : 0;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static float qSSmoother_Filter_LPF1( _qSSmoother_t *f,
+                                     const float x )
+{
+    float y;
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_LPF1_t * const s = (qSSmoother_LPF1_t* const)f;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    if ( 1u == f->init ) {
+        s->y1 = x;
+        f->init = 0u;
+    }
+    y = x + ( s->alpha*( s->y1 - x ) );
+    s->y1 = y;
+
+    return y;
+}
+/*============================================================================*/
+static float qSSmoother_Filter_LPF2( _qSSmoother_t *f,
+                                     const float x )
+{
+    float y;
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_LPF2_t * const s = (qSSmoother_LPF2_t* const)f;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    if ( 1u == f->init ) {
+        s->y1 = x;
+        s->y2 = x;
+        s->x1 = x;
+        s->x2 = x;
+        f->init = 0u;
+    }
+    y = ( s->k*x ) + ( s->b1*s->x1 ) + ( s->k*s->x2 )
+        - ( s->a1*s->y1 ) - ( s->a2*s->y2 );
+    s->x2 = s->x1;
+    s->x1 = x;
+    s->y2 = s->y1;
+    s->y1 = y;
+
+    return y;
+}
+/*============================================================================*/
+static float qSSmoother_Filter_MWM1( _qSSmoother_t *f,
+                                     const float x )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_MWM1_t * const s = (qSSmoother_MWM1_t* const)f;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    if ( 1u == f->init ) {
+        qSSmoother_WindowSet( s->w, s->wsize, x );
+        s->idx = 0u;
+        f->init = 0u;
+    }
+    /*cstat -CERT-FLP36-C*/
+    return qLTISys_DiscreteFIRRingUpdate( s->w, NULL, s->wsize, &s->idx, x )/(float)s->wsize;
+    /*cstat +CERT-FLP36-C*/
+}
+/*============================================================================*/
+static float qSSmoother_Filter_MWM2( _qSSmoother_t *f,
+                                     const float x )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d -CERT-FLP36-C*/
+    qSSmoother_MWM2_t * const s = (qSSmoother_MWM2_t* const)f;
+    float wsize = (float)s->tdl.itemcount;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d +CERT-FLP36-C*/
+    if ( 1u == f->init ) {
+        qTDL_Flush( &s->tdl, x );
+        s->sum = x*wsize;
+        f->init = 0u;
+    }
+    s->sum += x - qTDL_GetOldest( &s->tdl );
+    qTDL_InsertSample( &s->tdl, x );
+
+    return s->sum/wsize;
+}
+/*============================================================================*/
+static float qSSmoother_Filter_MOR1( _qSSmoother_t *f,
+                                     const float x )
+{
+    float m;
+    size_t k;
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_MOR1_t * const s = (qSSmoother_MOR1_t* const)f;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    if ( 1u == f->init ) {
+        qSSmoother_WindowSet( s->w, s->wsize, x );
+        s->m = x;
+        s->idx = 0u;
+        f->init = 0u;
+    }
+    k = s->idx; /*where the new sample goes*/
+    /*insert, sum and compensate*/
+    m = qLTISys_DiscreteFIRRingUpdate( s->w, NULL, s->wsize, &s->idx, x ) - x;
+    /*is it an outlier?*/
+    if ( qSSmoother_Abs( s->m - x ) > ( s->alpha*qSSmoother_Abs( s->m ) ) ) {
+        s->w[ k ] = s->m; /*replace the outlier with the dynamic median*/
+    }
+    /*cstat -CERT-FLP36-C*/
+    /*compute new mean for next iteration*/
+    s->m = ( m + s->w[ k ] ) / (float)s->wsize;
+    /*cstat +CERT-FLP36-C*/
+    return s->w[ k ];
+}
+/*============================================================================*/
+static float qSSmoother_Filter_MOR2( _qSSmoother_t *f,
+                                     const float x )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d -CERT-FLP36-C*/
+    qSSmoother_MOR2_t * const s = (qSSmoother_MOR2_t* const)f;
+    float wsize = (float)s->tdl.itemcount;
+    float xx = x;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d +CERT-FLP36-C*/
+    if ( 1u == f->init ) {
+        qTDL_Flush( &s->tdl, x );
+        s->sum = wsize*x;
+        s->m = x;
+        f->init = 0u;
+    }
+    /*is it an outlier?*/
+    if ( qSSmoother_Abs( s->m - x ) > ( s->alpha*qSSmoother_Abs( s->m ) ) ) {
+        xx = s->m; /*replace the outlier with the dynamic median*/
+    }
+    s->sum += xx - qTDL_GetOldest( &s->tdl );
+    s->m = s->sum/wsize;
+    qTDL_InsertSample( &s->tdl, xx );
+
+    return x;
+}
+/*============================================================================*/
+static float qSSmoother_Filter_GMWF( _qSSmoother_t *f,
+                                     const float x )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_GMWF_t * const s = (qSSmoother_GMWF_t* const)f;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    float y;
+
+    if ( 1u == f->init ) {
+        qSSmoother_WindowSet( s->w, s->wsize, x );
+        s->idx = 0u;
+        f->init = 0u;
+    }
+    if ( 0u != s->sym ) {
+        y = qLTISys_DiscreteFIRSymRingUpdate( s->w, s->k, s->wsize, &s->idx, x );
+    }
+    else {
+        y = qLTISys_DiscreteFIRRingUpdate( s->w, s->k, s->wsize, &s->idx, x );
+    }
+
+    return y;
+}
+/*============================================================================*/
+static float qSSmoother_Filter_KLMN( _qSSmoother_t *f,
+                                     const float x )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_KLMN_t * const s = (qSSmoother_KLMN_t* const)f;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    float pH;
+    if ( 1u == f->init ) {
+        s->x = x;
+        f->init = 0u;
+    }
+    /* Predict */
+    s->x = s->A*s->x;
+    s->p = ( s->A*s->A*s->p ) + s->q; /* p(n|n-1)=A^2*p(n-1|n-1)+q */
+    /* Measurement */
+    pH = s->p*s->H;
+    s->gain =  pH/( s->r + ( s->H*pH ) );
+    s->x += s->gain*( x - ( s->H*s->x ) );
+    s->p = ( 1.0f - ( s->gain*s->H ) )*s->p;
+
+    return s->x;
+}
+/*============================================================================*/
+static float qSSmoother_Filter_EXPW( _qSSmoother_t *f,
+                                     const float x )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_EXPW_t * const s = (qSSmoother_EXPW_t* const)f;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    float iw;
+
+    if ( 1u == f->init ) {
+        s->m = x;
+        s->w = 1.0f;
+        f->init = 0u;
+    }
+    s->w = ( s->lambda*s->w ) + 1.0f;
+    iw = 1.0f/s->w;
+    s->m = ( s->m*( 1.0f - iw ) ) + ( iw*x );
+
+    return s->m;
+}
+/*============================================================================*/
+static void qSSmoother_Block_LPF1( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_LPF1_t * const s = (qSSmoother_LPF1_t* const)f;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    const float alpha = s->alpha;
+    float y1;
+    size_t i;
+
+    if ( 1u == f->init ) {
+        s->y1 = x[ 0 ];
+        f->init = 0u;
+    }
+    y1 = s->y1;
+    for ( i = 0u ; i < n ; ++i ) {
+        const float xi = x[ i ];
+        y1 = xi + ( alpha*( y1 - xi ) );
+        y[ i ] = y1;
+    }
+    s->y1 = y1;
+}
+/*============================================================================*/
+static void qSSmoother_Block_LPF2( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_LPF2_t * const s = (qSSmoother_LPF2_t* const)f;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    const float k = s->k, a1 = s->a1, a2 = s->a2, b1 = s->b1;
+    float x1, x2, y1, y2;
+    size_t i;
+
+    if ( 1u == f->init ) {
+        s->y1 = x[ 0 ];
+        s->y2 = x[ 0 ];
+        s->x1 = x[ 0 ];
+        s->x2 = x[ 0 ];
+        f->init = 0u;
+    }
+    x1 = s->x1;
+    x2 = s->x2;
+    y1 = s->y1;
+    y2 = s->y2;
+    for ( i = 0u ; i < n ; ++i ) {
+        const float xi = x[ i ];
+        const float yi = ( k*xi ) + ( b1*x1 ) + ( k*x2 ) - ( a1*y1 ) - ( a2*y2 );
+        x2 = x1;
+        x1 = xi;
+        y2 = y1;
+        y1 = yi;
+        y[ i ] = yi;
+    }
+    s->x1 = x1;
+    s->x2 = x2;
+    s->y1 = y1;
+    s->y2 = y2;
+}
+/*============================================================================*/
+static void qSSmoother_Block_MWM1( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d -CERT-FLP36-C*/
+    qSSmoother_MWM1_t * const s = (qSSmoother_MWM1_t* const)f;
+    const float wsize = (float)s->wsize;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d +CERT-FLP36-C*/
+    size_t i;
+
+    if ( 1u == f->init ) {
+        qSSmoother_WindowSet( s->w, s->wsize, x[ 0 ] );
+        s->idx = 0u;
+        f->init = 0u;
+    }
+    for ( i = 0u ; i < n ; ++i ) {
+        y[ i ] = qLTISys_DiscreteFIRRingUpdate( s->w, NULL, s->wsize, &s->idx, x[ i ] )/wsize;
+    }
+}
+/*============================================================================*/
+static void qSSmoother_Block_MWM2( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d -CERT-FLP36-C*/
+    qSSmoother_MWM2_t * const s = (qSSmoother_MWM2_t* const)f;
+    const float wsize = (float)s->tdl.itemcount;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d +CERT-FLP36-C*/
+    float sum;
+    size_t i;
+
+    if ( 1u == f->init ) {
+        qTDL_Flush( &s->tdl, x[ 0 ] );
+        s->sum = x[ 0 ]*wsize;
+        f->init = 0u;
+    }
+    sum = s->sum;
+    for ( i = 0u ; i < n ; ++i ) {
+        const float xi = x[ i ];
+        sum += xi - qTDL_GetOldest( &s->tdl );
+        qTDL_InsertSample( &s->tdl, xi );
+        y[ i ] = sum/wsize;
+    }
+    s->sum = sum;
+}
+/*============================================================================*/
+static void qSSmoother_Block_MOR1( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d -CERT-FLP36-C*/
+    qSSmoother_MOR1_t * const s = (qSSmoother_MOR1_t* const)f;
+    const float wsize = (float)s->wsize;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d +CERT-FLP36-C*/
+    const float alpha = s->alpha;
+    float * const w = s->w;
+    float m;
+    size_t i, idx;
+
+    if ( 1u == f->init ) {
+        qSSmoother_WindowSet( s->w, s->wsize, x[ 0 ] );
+        s->m = x[ 0 ];
+        s->idx = 0u;
+        f->init = 0u;
+    }
+    m = s->m;
+    idx = s->idx;
+    for ( i = 0u ; i < n ; ++i ) {
+        const float xi = x[ i ];
+        const size_t k = idx; /*where the new sample goes*/
+        /*insert, sum and compensate*/
+        const float sum = qLTISys_DiscreteFIRRingUpdate( w, NULL, s->wsize, &idx, xi ) - xi;
+        /*is it an outlier?*/
+        if ( qSSmoother_Abs( m - xi ) > ( alpha*qSSmoother_Abs( m ) ) ) {
+            w[ k ] = m; /*replace the outlier with the dynamic median*/
+        }
+        m = ( sum + w[ k ] )/wsize;
+        y[ i ] = w[ k ];
+    }
+    s->m = m;
+    s->idx = idx;
+}
+/*============================================================================*/
+static void qSSmoother_Block_MOR2( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d -CERT-FLP36-C*/
+    qSSmoother_MOR2_t * const s = (qSSmoother_MOR2_t* const)f;
+    const float wsize = (float)s->tdl.itemcount;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d +CERT-FLP36-C*/
+    const float alpha = s->alpha;
+    float sum, m;
+    size_t i;
+
+    if ( 1u == f->init ) {
+        qTDL_Flush( &s->tdl, x[ 0 ] );
+        s->sum = wsize*x[ 0 ];
+        s->m = x[ 0 ];
+        f->init = 0u;
+    }
+    sum = s->sum;
+    m = s->m;
+    for ( i = 0u ; i < n ; ++i ) {
+        const float xi = x[ i ];
+        float xx = xi;
+        /*is it an outlier?*/
+        if ( qSSmoother_Abs( m - xi ) > ( alpha*qSSmoother_Abs( m ) ) ) {
+            xx = m; /*replace the outlier with the dynamic median*/
+        }
+        sum += xx - qTDL_GetOldest( &s->tdl );
+        m = sum/wsize;
+        qTDL_InsertSample( &s->tdl, xx );
+        y[ i ] = xi;
+    }
+    s->sum = sum;
+    s->m = m;
+}
+/*============================================================================*/
+static void qSSmoother_Block_GMWF( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_GMWF_t * const s = (qSSmoother_GMWF_t* const)f;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    size_t i;
+
+    if ( 1u == f->init ) {
+        qSSmoother_WindowSet( s->w, s->wsize, x[ 0 ] );
+        s->idx = 0u;
+        f->init = 0u;
+    }
+    if ( NULL != s->fft.h ) {
+        (void)qLTISys_DiscreteFIRRingBlock( s->w, s->k, s->wsize, &s->idx, x, y, n, &s->fft );
+    }
+    else if ( 0u != s->sym ) {
+        for ( i = 0u ; i < n ; ++i ) {
+            y[ i ] = qLTISys_DiscreteFIRSymRingUpdate( s->w, s->k, s->wsize, &s->idx, x[ i ] );
+        }
+    }
+    else {
+        for ( i = 0u ; i < n ; ++i ) {
+            y[ i ] = qLTISys_DiscreteFIRRingUpdate( s->w, s->k, s->wsize, &s->idx, x[ i ] );
+        }
+    }
+}
+/*============================================================================*/
+static void qSSmoother_Block_KLMN( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_KLMN_t * const s = (qSSmoother_KLMN_t* const)f;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    const float A = s->A, H = s->H, q = s->q, r = s->r;
+    float xs, p, gain = s->gain;
+    size_t i;
+
+    if ( 1u == f->init ) {
+        s->x = x[ 0 ];
+        f->init = 0u;
+    }
+    xs = s->x;
+    p = s->p;
+    for ( i = 0u ; i < n ; ++i ) {
+        float pH;
+        /* Predict */
+        xs = A*xs;
+        p = ( A*A*p ) + q; /* p(n|n-1)=A^2*p(n-1|n-1)+q */
+        /* Measurement */
+        pH = p*H;
+        gain = pH/( r + ( H*pH ) );
+        xs += gain*( x[ i ] - ( H*xs ) );
+        p = ( 1.0f - ( gain*H ) )*p;
+        y[ i ] = xs;
+    }
+    s->x = xs;
+    s->p = p;
+    s->gain = gain;
+}
+/*============================================================================*/
+static void qSSmoother_Block_EXPW( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_EXPW_t * const s = (qSSmoother_EXPW_t* const)f;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    const float lambda = s->lambda;
+    float m, w;
+    size_t i;
+
+    if ( 1u == f->init ) {
+        s->m = x[ 0 ];
+        s->w = 1.0f;
+        f->init = 0u;
+    }
+    m = s->m;
+    w = s->w;
+    for ( i = 0u ; i < n ; ++i ) {
+        float iw;
+        w = ( lambda*w ) + 1.0f;
+        iw = 1.0f/w;
+        m = ( m*( 1.0f - iw ) ) + ( iw*x[ i ] );
+        y[ i ] = m;
+    }
+    s->m = m;
+    s->w = w;
+}
+/*============================================================================*/
+static void qSSmoother_Block_MEDN( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_MEDN_t * const s = (qSSmoother_MEDN_t* const)f;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    size_t i;
+
+    y[ 0 ] = qSSmoother_Filter_MEDN( f, x[ 0 ] ); /*handles the init*/
+    for ( i = 1u ; i < n ; ++i ) {
+        qSSmoother_MednInsert( s, x[ i ] );
+        y[ i ] = qSSmoother_MednGet( s );
+    }
+}
+/*============================================================================*/
+static void qSSmoother_Block_HMPL( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_HMPL_t * const s = (qSSmoother_HMPL_t* const)f;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    size_t i;
+
+    y[ 0 ] = qSSmoother_Filter_HMPL( f, x[ 0 ] ); /*handles the init*/
+    for ( i = 1u ; i < n ; ++i ) {
+        y[ i ] = qSSmoother_HmplUpdate( s, x[ i ] );
+    }
+}
+/*============================================================================*/
+static void qSSmoother_Block_MMAX( _qSSmoother_t * const f,
+                                   const float * const x,
+                                   float * const y,
+                                   const size_t n )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_MMAX_t * const s = (qSSmoother_MMAX_t* const)f;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    size_t i;
+
+    y[ 0 ] = qSSmoother_Filter_MMAX( f, x[ 0 ] ); /*handles the init*/
+    for ( i = 1u ; i < n ; ++i ) {
+        y[ i ] = qSSmoother_MmaxUpdate( s, x[ i ] );
+    }
+}
+/*============================================================================*/
+static void qSSmoother_Block_SOS( _qSSmoother_t * const f,
+                                  const float * const x,
+                                  float * const y,
+                                  const size_t n )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_SOS_t * const s = (qSSmoother_SOS_t* const)f;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    size_t k = 0u;
+
+    if ( 1u == f->init ) {
+        qSSmoother_SosSeed( s->c, s->d, s->ns, 1u, x[ 0 ] );
+        f->init = 0u;
+    }
+    #if defined( QSIMD_X86 )
+    if ( QSIMD_NONE != s->simd ) {
+        for ( ; ( k + 4u ) <= s->ns ; k += 4u ) {
+            qSSmoother_SosGroupSSE2( &s->c[ 5u*k ], &s->d[ 2u*k ], ( 0u == k )? x : y, y, n );
+        }
+    }
+    #elif defined( QSIMD_ARM )
+    if ( QSIMD_NEON == s->simd ) {
+        for ( ; ( k + 4u ) <= s->ns ; k += 4u ) {
+            qSSmoother_SosGroupNEON( &s->c[ 5u*k ], &s->d[ 2u*k ], ( 0u == k )? x : y, y, n );
+        }
+    }
+    #endif
+    if ( k < s->ns ) {
+        /*the remaining sections, one sample at a time*/
+        const float * const u = ( 0u == k )? x : y;
+        size_t i, j;
+
+        for ( i = 0u ; i < n ; ++i ) {
+            float ui = u[ i ];
+
+            for ( j = k ; j < s->ns ; ++j ) {
+                const float * const c = &s->c[ 5u*j ];
+                float * const d = &s->d[ 2u*j ];
+                const float v = ( c[ 0 ]*ui ) + d[ 0 ];
+
+                d[ 0 ] = ( ( c[ 1 ]*ui ) + d[ 1 ] ) - ( c[ 3 ]*v );
+                d[ 1 ] = ( c[ 2 ]*ui ) - ( c[ 4 ]*v );
+                ui = v;
+            }
+            y[ i ] = ui;
+        }
+    }
+}
+/*============================================================================*/
+int qSSmoother_Bank_Setup( qSSmootherBankPtr_t * const b,
+                           const qSSmoother_Type_t type,
+                           const float * const param,
+                           float *area,
+                           const size_t nc )
+{
+    static struct qSmoother_Bank_Vtbl_s qSmoother_Bank_Vtbl[ 13 ] = {
+        { &qSSmoother_Bank_Setup_LPF1, &qSSmoother_Bank_Block_LPF1 },
+        { &qSSmoother_Bank_Setup_LPF2, &qSSmoother_Bank_Block_LPF2 },
+        { NULL, NULL }, /*MWM1*/
+        { NULL, NULL }, /*MWM2*/
+        { NULL, NULL }, /*MOR1*/
+        { NULL, NULL }, /*MOR2*/
+        { NULL, NULL }, /*GMWF*/
+        { &qSSmoother_Bank_Setup_KLMN, &qSSmoother_Bank_Block_KLMN },
+        { &qSSmoother_Bank_Setup_EXPW, &qSSmoother_Bank_Block_EXPW },
+        { NULL, NULL }, /*MEDN*/
+        { NULL, NULL }, /*HMPL*/
+        { NULL, NULL }, /*MMAX*/
+        { &qSSmoother_Bank_Setup_SOS, &qSSmoother_Bank_Block_SOS },
+    };
+    int retValue = 0;
+    const size_t maxTypes = sizeof(qSmoother_Bank_Vtbl)/sizeof(qSmoother_Bank_Vtbl[ 0 ] );
+
+    if ( ( NULL != b ) && ( NULL != area ) && ( nc > 0u ) &&
+         ( (size_t)type < maxTypes ) && ( NULL != qSmoother_Bank_Vtbl[ type ].setup ) ) {
+        /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+        _qSSmoother_Bank_t * const self = (_qSSmoother_Bank_t* const)b;
+        /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+        self->vt = &qSmoother_Bank_Vtbl[ type ];
+        self->nc = nc;
+        self->simd = qSIMD_Select();
+        retValue = qSmoother_Bank_Vtbl[ type ].setup( self, param, area );
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+int qSSmoother_Bank_Reset( qSSmootherBankPtr_t * const b )
+{
+    int retValue = 0;
+
+    if ( NULL != b ) {
+        /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+        _qSSmoother_Bank_t * const self = (_qSSmoother_Bank_t* const)b;
+        /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+        self->init = 1u;
+        retValue = 1;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+int qSSmoother_Bank_PerformFrame( qSSmootherBankPtr_t * const b,
+                                  const float * const x,
+                                  float * const y )
+{
+    return qSSmoother_Bank_PerformBlock( b, x, y, 1u );
+}
+/*============================================================================*/
+int qSSmoother_Bank_PerformBlock( qSSmootherBankPtr_t * const b,
+                                  const float * const x,
+                                  float * const y,
+                                  const size_t n )
+{
+    int retValue = 0;
+
+    if ( ( NULL != b ) && ( NULL != x ) && ( NULL != y ) ) {
+        /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+        _qSSmoother_Bank_t * const self = (_qSSmoother_Bank_t* const)b;
+        struct qSmoother_Bank_Vtbl_s *vt = self->vt;
+        /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+        if ( ( NULL != vt ) && ( NULL != vt->block ) ) {
+            if ( n > 0u ) {
+                vt->block( self, x, y, n );
+            }
+            retValue = 1;
+        }
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+int qSSmoother_Bank_SetAccel( qSSmootherBankPtr_t * const b,
+                              const uint8_t enable )
+{
+    int retValue = 0;
+
+    if ( NULL != b ) {
+        /*cstat -MISRAC2012-Rule-11.5 -CERT-EXP36-C_b*/
+        _qSSmoother_Bank_t * const self = (_qSSmoother_Bank_t* const)b;
+        /*cstat +MISRAC2012-Rule-11.5 +CERT-EXP36-C_b*/
+        self->simd = ( 0u != enable )? qSIMD_Select() : QSIMD_NONE;
+        retValue = ( ( 0u == enable ) || ( QSIMD_NONE != self->simd ) )? 1 : 0;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static int qSSmoother_Bank_Setup_LPF1( _qSSmoother_Bank_t * const b,
+                                       const float * const param,
+                                       float *area )
+{
+    int retValue = 0;
+    float alpha = param[ 0 ];
+
+    if ( ( alpha > 0.0f ) && ( alpha < 1.0f ) ) {
+        /*cstat -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d -CERT-EXP36-C_a*/
+        qSSmoother_LPF1_Bank_t * const s = (qSSmoother_LPF1_Bank_t* const)b;
+        /*cstat +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d +CERT-EXP36-C_a*/
+        s->y1 = area;
+        s->alpha = alpha;
+        retValue = qSSmoother_Bank_Reset( s );
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static int qSSmoother_Bank_Setup_LPF2( _qSSmoother_Bank_t * const b,
+                                       const float * const param,
+                                       float *area )
+{
+    int retValue = 0;
+    float alpha = param[ 0 ];
+
+    if ( ( alpha > 0.0f ) && ( alpha < 1.0f ) ) {
+        /*cstat -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d -CERT-EXP36-C_a*/
+        qSSmoother_LPF2_Bank_t * const s = (qSSmoother_LPF2_Bank_t* const)b;
+        /*cstat +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d +CERT-EXP36-C_a*/
+        s->x1 = area;
+        s->x2 = &area[ b->nc ];
+        s->y1 = &area[ 2u*b->nc ];
+        s->y2 = &area[ 3u*b->nc ];
+        qSSmoother_LPF2Coeffs( alpha, &s->k, &s->a1, &s->a2, &s->b1 );
+        retValue = qSSmoother_Bank_Reset( s );
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static int qSSmoother_Bank_Setup_KLMN( _qSSmoother_Bank_t * const b,
+                                       const float * const param,
+                                       float *area )
+{
+    int retValue = 0;
+    float p = param[ 0 ];
+    float q = param[ 1 ];
+    float r = param[ 2 ];
+
+    if ( ( p > 0.0f ) && ( q > 0.0f ) && ( r > 0.0f ) ) {
+        /*cstat -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d -CERT-EXP36-C_a*/
+        qSSmoother_KLMN_Bank_t * const s = (qSSmoother_KLMN_Bank_t* const)b;
+        /*cstat +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d +CERT-EXP36-C_a*/
+        s->x = area;
+        s->p = p;
+        s->q = q;
+        s->r = r;
+        s->gain = 0.0f;
+        retValue = qSSmoother_Bank_Reset( s );
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static int qSSmoother_Bank_Setup_EXPW( _qSSmoother_Bank_t * const b,
+                                       const float * const param,
+                                       float *area )
+{
+    int retValue = 0;
+    float lambda = param[ 0 ];
+
+    if ( ( lambda > 0.0f ) && ( lambda < 1.0f ) ) {
+        /*cstat -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d -CERT-EXP36-C_a*/
+        qSSmoother_EXPW_Bank_t * const s = (qSSmoother_EXPW_Bank_t* const)b;
+        /*cstat +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d +CERT-EXP36-C_a*/
+        s->m = area;
+        s->lambda = lambda;
+        s->w = 1.0f;
+        retValue = qSSmoother_Bank_Reset( s );
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static int qSSmoother_Bank_Setup_SOS( _qSSmoother_Bank_t * const b,
+                                      const float * const param,
+                                      float *area )
+{
+    int retValue = 0;
+    const size_t ns = qSSmoother_SosCheck( param );
+
+    if ( ns > 0u ) {
+        /*cstat -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d -CERT-EXP36-C_a*/
+        qSSmoother_SOS_Bank_t * const s = (qSSmoother_SOS_Bank_t* const)b;
+        /*cstat +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d +CERT-EXP36-C_a*/
+        s->ns = ns;
+        s->c = area;
+        s->d = &area[ 5u*ns ];
+        (void)memcpy( s->c, &param[ 1 ], 5u*ns*sizeof(float) );
+        retValue = qSSmoother_Bank_Reset( s );
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static void qSSmoother_Bank_Block_LPF1( _qSSmoother_Bank_t * const b,
+                                        const float * const x,
+                                        float * const y,
+                                        const size_t n )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_LPF1_Bank_t * const s = (qSSmoother_LPF1_Bank_t* const)b;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    const size_t nc = b->nc;
+    size_t t;
+
+    if ( 1u == b->init ) {
+        (void)memcpy( s->y1, x, nc*sizeof(float) );
+        b->init = 0u;
+    }
+    for ( t = 0u ; t < n ; ++t ) {
+        /*y = x + alpha*( y1 - x )*/
+        qSSmoother_BankLerp( s->y1, &x[ t*nc ], s->y1, &y[ t*nc ], nc, s->alpha, s->b.simd );
+    }
+}
+/*============================================================================*/
+static void qSSmoother_Bank_Block_LPF2( _qSSmoother_Bank_t * const b,
+                                        const float * const x,
+                                        float * const y,
+                                        const size_t n )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_LPF2_Bank_t * const s = (qSSmoother_LPF2_Bank_t* const)b;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    const size_t nc = b->nc;
+    size_t t;
+
+    if ( 1u == b->init ) {
+        (void)memcpy( s->x1, x, nc*sizeof(float) );
+        (void)memcpy( s->x2, x, nc*sizeof(float) );
+        (void)memcpy( s->y1, x, nc*sizeof(float) );
+        (void)memcpy( s->y2, x, nc*sizeof(float) );
+        b->init = 0u;
+    }
+    for ( t = 0u ; t < n ; ++t ) {
+        float *tmp;
+        /*the new delays overwrite the oldest ones, so only the roles of the
+        arrays are swapped instead of moving the samples*/
+        qSSmoother_BankBiquad( s, &x[ t*nc ], &y[ t*nc ] );
+        tmp = s->x2;
+        s->x2 = s->x1;
+        s->x1 = tmp;
+        tmp = s->y2;
+        s->y2 = s->y1;
+        s->y1 = tmp;
+    }
+}
+/*============================================================================*/
+static void qSSmoother_Bank_Block_KLMN( _qSSmoother_Bank_t * const b,
+                                        const float * const x,
+                                        float * const y,
+                                        const size_t n )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_KLMN_Bank_t * const s = (qSSmoother_KLMN_Bank_t* const)b;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    const size_t nc = b->nc;
+    float p = s->p, gain = s->gain;
+    size_t t;
+
+    if ( 1u == b->init ) {
+        (void)memcpy( s->x, x, nc*sizeof(float) );
+        b->init = 0u;
+    }
+    for ( t = 0u ; t < n ; ++t ) {
+        /*with A = H = 1, the covariance and the gain are the same for all
+        the channels*/
+        p = p + s->q;
+        gain = p/( s->r + p );
+        p = ( 1.0f - gain )*p;
+        /*x = x + gain*( z - x )*/
+        qSSmoother_BankLerp( s->x, s->x, &x[ t*nc ], &y[ t*nc ], nc, gain, s->b.simd );
+    }
+    s->p = p;
+    s->gain = gain;
+}
+/*============================================================================*/
+static void qSSmoother_Bank_Block_EXPW( _qSSmoother_Bank_t * const b,
+                                        const float * const x,
+                                        float * const y,
+                                        const size_t n )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_EXPW_Bank_t * const s = (qSSmoother_EXPW_Bank_t* const)b;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    const size_t nc = b->nc;
+    float w;
+    size_t t;
+
+    if ( 1u == b->init ) {
+        (void)memcpy( s->m, x, nc*sizeof(float) );
+        s->w = 1.0f;
+        b->init = 0u;
+    }
+    w = s->w;
+    for ( t = 0u ; t < n ; ++t ) {
+        float iw;
+        w = ( s->lambda*w ) + 1.0f;
+        iw = 1.0f/w;
+        /*m = m*( 1 - iw ) + iw*x*/
+        qSSmoother_BankMix( s->m, &x[ t*nc ], &y[ t*nc ], nc, 1.0f - iw, iw, s->b.simd );
+    }
+    s->w = w;
+}
+/*============================================================================*/
+static void qSSmoother_Bank_Block_SOS( _qSSmoother_Bank_t * const b,
+                                       const float * const x,
+                                       float * const y,
+                                       const size_t n )
+{
+    /*cstat -CERT-EXP36-C_a -MISRAC2012-Rule-11.3 -CERT-EXP39-C_d*/
+    qSSmoother_SOS_Bank_t * const s = (qSSmoother_SOS_Bank_t* const)b;
+    /*cstat +CERT-EXP36-C_a +MISRAC2012-Rule-11.3 +CERT-EXP39-C_d*/
+    const size_t nc = b->nc;
+    size_t t;
+
+    if ( 1u == b->init ) {
+        for ( t = 0u ; t < nc ; ++t ) {
+            qSSmoother_SosSeed( s->c, &s->d[ t ], s->ns, nc, x[ t ] );
+        }
+        b->init = 0u;
+    }
+    for ( t = 0u ; t < n ; ++t ) {
+        qSSmoother_BankSos( s, &x[ t*nc ], &y[ t*nc ] );
+    }
+}
+/*============================================================================*/
+static void qSSmoother_BankLerp( float * const s,
+                                 const float * const p,
+                                 const float * const q,
+                                 float * const y,
+                                 const size_t nc,
+                                 const float c,
+                                 const uint8_t simd )
+{
+    size_t i = 0u;
+
+    #if defined( QSIMD_X86 )
+    if ( QSIMD_AVX512 == simd ) {
+        i = qSSmoother_BankLerpAVX512( s, p, q, y, nc, c );
+    }
+    else if ( QSIMD_AVX2 == simd ) {
+        i = qSSmoother_BankLerpAVX2( s, p, q, y, nc, c );
+    }
+    else if ( QSIMD_SSE2 == simd ) {
+        i = qSSmoother_BankLerpSSE2( s, p, q, y, nc, c );
+    }
+    else {
+        /*nothing to do, use the portable path*/
+    }
+    #elif defined( QSIMD_ARM )
+    if ( QSIMD_NEON == simd ) {
+        i = qSSmoother_BankLerpNEON( s, p, q, y, nc, c );
+    }
+    #else
+    (void)simd;
+    #endif
+    for ( ; i < nc ; ++i ) {
+        const float v = p[ i ] + ( c*( q[ i ] - p[ i ] ) );
+        s[ i ] = v;
+        y[ i ] = v;
+    }
+}
+/*============================================================================*/
+static void qSSmoother_BankMix( float * const s,
+                                const float * const x,
+                                float * const y,
+                                const size_t nc,
+                                const float a,
+                                const float c,
+                                const uint8_t simd )
+{
+    size_t i = 0u;
+
+    #if defined( QSIMD_X86 )
+    if ( QSIMD_AVX512 == simd ) {
+        i = qSSmoother_BankMixAVX512( s, x, y, nc, a, c );
+    }
+    else if ( QSIMD_AVX2 == simd ) {
+        i = qSSmoother_BankMixAVX2( s, x, y, nc, a, c );
+    }
+    else if ( QSIMD_SSE2 == simd ) {
+        i = qSSmoother_BankMixSSE2( s, x, y, nc, a, c );
+    }
+    else {
+        /*nothing to do, use the portable path*/
+    }
+    #elif defined( QSIMD_ARM )
+    if ( QSIMD_NEON == simd ) {
+        i = qSSmoother_BankMixNEON( s, x, y, nc, a, c );
+    }
+    #else
+    (void)simd;
+    #endif
+    for ( ; i < nc ; ++i ) {
+        const float v = ( s[ i ]*a ) + ( c*x[ i ] );
+        s[ i ] = v;
+        y[ i ] = v;
+    }
+}
+/*============================================================================*/
+static void qSSmoother_BankBiquad( const qSSmoother_LPF2_Bank_t * const s,
+                                   const float * const x,
+                                   float * const y )
+{
+    const float k = s->k, a1 = s->a1, a2 = s->a2, b1 = s->b1;
+    float * const x2 = s->x2;
+    float * const y2 = s->y2;
+    size_t i = 0u;
+
+    #if defined( QSIMD_X86 )
+    if ( QSIMD_AVX512 == s->b.simd ) {
+        i = qSSmoother_BankBiquadAVX512( s, x, y );
+    }
+    else if ( QSIMD_AVX2 == s->b.simd ) {
+        i = qSSmoother_BankBiquadAVX2( s, x, y );
+    }
+    else if ( QSIMD_SSE2 == s->b.simd ) {
+        i = qSSmoother_BankBiquadSSE2( s, x, y );
+    }
+    else {
+        /*nothing to do, use the portable path*/
+    }
+    #elif defined( QSIMD_ARM )
+    if ( QSIMD_NEON == s->b.simd ) {
+        i = qSSmoother_BankBiquadNEON( s, x, y );
+    }
+    #endif
+    for ( ; i < s->b.nc ; ++i ) {
+        const float xi = x[ i ];
+        const float yi = ( k*xi ) + ( b1*s->x1[ i ] ) + ( k*x2[ i ] )
+                         - ( a1*s->y1[ i ] ) - ( a2*y2[ i ] );
+        x2[ i ] = xi;
+        y2[ i ] = yi;
+        y[ i ] = yi;
+    }
+}
+/*============================================================================*/
+static void qSSmoother_BankSos( const qSSmoother_SOS_Bank_t * const s,
+                                const float * const x,
+                                float * const y )
+{
+    const size_t nc = s->b.nc;
+    size_t i = 0u, k;
+
+    #if defined( QSIMD_X86 )
+    if ( QSIMD_AVX512 == s->b.simd ) {
+        i = qSSmoother_BankSosAVX512( s, x, y );
+    }
+    else if ( QSIMD_AVX2 == s->b.simd ) {
+        i = qSSmoother_BankSosAVX2( s, x, y );
+    }
+    else if ( QSIMD_SSE2 == s->b.simd ) {
+        i = qSSmoother_BankSosSSE2( s, x, y );
+    }
+    else {
+        /*nothing to do, use the portable path*/
+    }
+    #elif defined( QSIMD_ARM )
+    if ( QSIMD_NEON == s->b.simd ) {
+        i = qSSmoother_BankSosNEON( s, x, y );
+    }
+    #endif
+    for ( ; i < nc ; ++i ) {
+        float u = x[ i ];
+        /*the whole cascade of a channel before the next one*/
+        for ( k = 0u ; k < s->ns ; ++k ) {
+            const float * const c = &s->c[ 5u*k ];
+            float * const d1 = &s->d[ 2u*k*nc ];
+            float * const d2 = &s->d[ ( ( 2u*k ) + 1u )*nc ];
+            const float v = ( c[ 0 ]*u ) + d1[ i ];
+
+            d1[ i ] = ( ( c[ 1 ]*u ) + d2[ i ] ) - ( c[ 3 ]*v );
+            d2[ i ] = ( c[ 2 ]*u ) - ( c[ 4 ]*v );
+            u = v;
+        }
+        y[ i ] = u;
+    }
+}
+/*============================================================================*/
+#if defined( QSIMD_X86 )
+__attribute__(( target( "sse2" ) ))
+static size_t qSSmoother_BankLerpSSE2( float * const s,
+                                       const float * const p,
+                                       const float * const q,
+                                       float * const y,
+                                       const size_t nc,
+                                       const float c )
+{
+    const __m128 vc = _mm_set1_ps( c );
+    size_t i;
+
+    for ( i = 0u ; ( i + 4u ) <= nc ; i += 4u ) {
+        const __m128 vp = _mm_loadu_ps( &p[ i ] );
+        const __m128 d = _mm_sub_ps( _mm_loadu_ps( &q[ i ] ), vp );
+        const __m128 v = _mm_add_ps( vp, _mm_mul_ps( vc, d ) );
+
+        _mm_storeu_ps( &s[ i ], v );
+        _mm_storeu_ps( &y[ i ], v );
+    }
+
+    return i;
+}
+/*============================================================================*/
+__attribute__(( target( "sse2" ) ))
+static size_t qSSmoother_BankMixSSE2( float * const s,
+                                      const float * const x,
+                                      float * const y,
+                                      const size_t nc,
+                                      const float a,
+                                      const float c )
+{
+    const __m128 va = _mm_set1_ps( a );
+    const __m128 vc = _mm_set1_ps( c );
+    size_t i;
+
+    for ( i = 0u ; ( i + 4u ) <= nc ; i += 4u ) {
+        const __m128 vs = _mm_mul_ps( _mm_loadu_ps( &s[ i ] ), va );
+        const __m128 v = _mm_add_ps( vs, _mm_mul_ps( vc, _mm_loadu_ps( &x[ i ] ) ) );
+
+        _mm_storeu_ps( &s[ i ], v );
+        _mm_storeu_ps( &y[ i ], v );
+    }
+
+    return i;
+}
+/*============================================================================*/
+__attribute__(( target( "sse2" ) ))
+static size_t qSSmoother_BankBiquadSSE2( const qSSmoother_LPF2_Bank_t * const s,
+                                         const float * const x,
+                                         float * const y )
+{
+    const __m128 k = _mm_set1_ps( s->k );
+    const __m128 a1 = _mm_set1_ps( s->a1 );
+    const __m128 a2 = _mm_set1_ps( s->a2 );
+    const __m128 b1 = _mm_set1_ps( s->b1 );
+    const size_t nc = s->b.nc;
+    size_t i;
+
+    for ( i = 0u ; ( i + 4u ) <= nc ; i += 4u ) {
+        const __m128 xi = _mm_loadu_ps( &x[ i ] );
+        __m128 yi = _mm_mul_ps( k, xi );
+
+        yi = _mm_add_ps( yi, _mm_mul_ps( b1, _mm_loadu_ps( &s->x1[ i ] ) ) );
+        yi = _mm_add_ps( yi, _mm_mul_ps( k, _mm_loadu_ps( &s->x2[ i ] ) ) );
+        yi = _mm_sub_ps( yi, _mm_mul_ps( a1, _mm_loadu_ps( &s->y1[ i ] ) ) );
+        yi = _mm_sub_ps( yi, _mm_mul_ps( a2, _mm_loadu_ps( &s->y2[ i ] ) ) );
+        _mm_storeu_ps( &s->x2[ i ], xi );
+        _mm_storeu_ps( &s->y2[ i ], yi );
+        _mm_storeu_ps( &y[ i ], yi );
+    }
+
+    return i;
+}
+/*============================================================================*/
+__attribute__(( target( "avx2" ) ))
+static size_t qSSmoother_BankLerpAVX2( float * const s,
+                                       const float * const p,
+                                       const float * const q,
+                                       float * const y,
+                                       const size_t nc,
+                                       const float c )
+{
+    const __m256 vc = _mm256_set1_ps( c );
+    size_t i;
+
+    for ( i = 0u ; ( i + 8u ) <= nc ; i += 8u ) {
+        const __m256 vp = _mm256_loadu_ps( &p[ i ] );
+        const __m256 d = _mm256_sub_ps( _mm256_loadu_ps( &q[ i ] ), vp );
+        const __m256 v = _mm256_add_ps( vp, _mm256_mul_ps( vc, d ) );
+
+        _mm256_storeu_ps( &s[ i ], v );
+        _mm256_storeu_ps( &y[ i ], v );
+    }
+
+    return i;
+}
+/*============================================================================*/
+__attribute__(( target( "avx2" ) ))
+static size_t qSSmoother_BankMixAVX2( float * const s,
+                                      const float * const x,
+                                      float * const y,
+                                      const size_t nc,
+                                      const float a,
+                                      const float c )
+{
+    const __m256 va = _mm256_set1_ps( a );
+    const __m256 vc = _mm256_set1_ps( c );
+    size_t i;
+
+    for ( i = 0u ; ( i + 8u ) <= nc ; i += 8u ) {
+        const __m256 vs = _mm256_mul_ps( _mm256_loadu_ps( &s[ i ] ), va );
+        const __m256 v = _mm256_add_ps( vs, _mm256_mul_ps( vc, _mm256_loadu_ps( &x[ i ] ) ) );
+
+        _mm256_storeu_ps( &s[ i ], v );
+        _mm256_storeu_ps( &y[ i ], v );
+    }
+
+    return i;
+}
+/*============================================================================*/
+__attribute__(( target( "avx2" ) ))
+static size_t qSSmoother_BankBiquadAVX2( const qSSmoother_LPF2_Bank_t * const s,
+                                         const float * const x,
+                                         float * const y )
+{
+    const __m256 k = _mm256_set1_ps( s->k );
+    const __m256 a1 = _mm256_set1_ps( s->a1 );
+    const __m256 a2 = _mm256_set1_ps( s->a2 );
+    const __m256 b1 = _mm256_set1_ps( s->b1 );
+    const size_t nc = s->b.nc;
+    size_t i;
+
+    for ( i = 0u ; ( i + 8u ) <= nc ; i += 8u ) {
+        const __m256 xi = _mm256_loadu_ps( &x[ i ] );
+        __m256 yi = _mm256_mul_ps( k, xi );
+
+        yi = _mm256_add_ps( yi, _mm256_mul_ps( b1, _mm256_loadu_ps( &s->x1[ i ] ) ) );
+        yi = _mm256_add_ps( yi, _mm256_mul_ps( k, _mm256_loadu_ps( &s->x2[ i ] ) ) );
+        yi = _mm256_sub_ps( yi, _mm256_mul_ps( a1, _mm256_loadu_ps( &s->y1[ i ] ) ) );
+        yi = _mm256_sub_ps( yi, _mm256_mul_ps( a2, _mm256_loadu_ps( &s->y2[ i ] ) ) );
+        _mm256_storeu_ps( &s->x2[ i ], xi );
+        _mm256_storeu_ps( &s->y2[ i ], yi );
+        _mm256_storeu_ps( &y[ i ], yi );
+    }
+
+    return i;
+}
+/*============================================================================*/
+__attribute__(( target( "avx512f" ) ))
+static size_t qSSmoother_BankLerpAVX512( float * const s,
+                                         const float * const p,
+                                         const float * const q,
+                                         float * const y,
+                                         const size_t nc,
+                                         const float c )
+{
+    const __m512 vc = _mm512_set1_ps( c );
+    size_t i;
+
+    for ( i = 0u ; ( i + 16u ) <= nc ; i += 16u ) {
+        const __m512 vp = _mm512_loadu_ps( &p[ i ] );
+        const __m512 d = _mm512_sub_ps( _mm512_loadu_ps( &q[ i ] ), vp );
+        const __m512 v = _mm512_add_ps( vp, _mm512_mul_ps( vc, d ) );
+
+        _mm512_storeu_ps( &s[ i ], v );
+        _mm512_storeu_ps( &y[ i ], v );
+    }
+
+    return i;
+}
+/*============================================================================*/
+__attribute__(( target( "avx512f" ) ))
+static size_t qSSmoother_BankMixAVX512( float * const s,
+                                        const float * const x,
+                                        float * const y,
+                                        const size_t nc,
+                                        const float a,
+                                        const float c )
+{
+    const __m512 va = _mm512_set1_ps( a );
+    const __m512 vc = _mm512_set1_ps( c );
+    size_t i;
+
+    for ( i = 0u ; ( i + 16u ) <= nc ; i += 16u ) {
+        const __m512 vs = _mm512_mul_ps( _mm512_loadu_ps( &s[ i ] ), va );
+        const __m512 v = _mm512_add_ps( vs, _mm512_mul_ps( vc, _mm512_loadu_ps( &x[ i ] ) ) );
+
+        _mm512_storeu_ps( &s[ i ], v );
+        _mm512_storeu_ps( &y[ i ], v );
+    }
+
+    return i;
+}
+/*============================================================================*/
+__attribute__(( target( "avx512f" ) ))
+static size_t qSSmoother_BankBiquadAVX512( const qSSmoother_LPF2_Bank_t * const s,
+                                           const float * const x,
+                                           float * const y )
+{
+    const __m512 k = _mm512_set1_ps( s->k );
+    const __m512 a1 = _mm512_set1_ps( s->a1 );
+    const __m512 a2 = _mm512_set1_ps( s->a2 );
+    const __m512 b1 = _mm512_set1_ps( s->b1 );
+    const size_t nc = s->b.nc;
+    size_t i;
+
+    for ( i = 0u ; ( i + 16u ) <= nc ; i += 16u ) {
+        const __m512 xi = _mm512_loadu_ps( &x[ i ] );
+        __m512 yi = _mm512_mul_ps( k, xi );
+
+        yi = _mm512_add_ps( yi, _mm512_mul_ps( b1, _mm512_loadu_ps( &s->x1[ i ] ) ) );
+        yi = _mm512_add_ps( yi, _mm512_mul_ps( k, _mm512_loadu_ps( &s->x2[ i ] ) ) );
+        yi = _mm512_sub_ps( yi, _mm512_mul_ps( a1, _mm512_loadu_ps( &s->y1[ i ] ) ) );
+        yi = _mm512_sub_ps( yi, _mm512_mul_ps( a2, _mm512_loadu_ps( &s->y2[ i ] ) ) );
+        _mm512_storeu_ps( &s->x2[ i ], xi );
+        _mm512_storeu_ps( &s->y2[ i ], yi );
+        _mm512_storeu_ps( &y[ i ], yi );
+    }
+
+    return i;
+}
+/*============================================================================*/
+__attribute__(( target( "sse2" ) ))
+static size_t qSSmoother_BankSosSSE2( const qSSmoother_SOS_Bank_t * const s,
+                                      const float * const x,
+                                      float * const y )
+{
+    const size_t nc = s->b.nc;
+    size_t i, k;
+
+    for ( i = 0u ; ( i + 4u ) <= nc ; i += 4u ) {
+        __m128 u = _mm_loadu_ps( &x[ i ] );
+
+        for ( k = 0u ; k < s->ns ; ++k ) {
+            const float * const c = &s->c[ 5u*k ];
+            float * const d1 = &s->d[ ( 2u*k*nc ) + i ];
+            float * const d2 = &s->d[ ( ( ( 2u*k ) + 1u )*nc ) + i ];
+            const __m128 w = _mm_mul_ps( _mm_set1_ps( c[ 0 ] ), u );
+            const __m128 v = _mm_add_ps( w, _mm_loadu_ps( d1 ) );
+            __m128 t = _mm_add_ps( _mm_mul_ps( _mm_set1_ps( c[ 1 ] ), u ), _mm_loadu_ps( d2 ) );
+
+            _mm_storeu_ps( d1, _mm_sub_ps( t, _mm_mul_ps( _mm_set1_ps( c[ 3 ] ), v ) ) );
+            t = _mm_sub_ps( _mm_mul_ps( _mm_set1_ps( c[ 2 ] ), u ),
+                            _mm_mul_ps( _mm_set1_ps( c[ 4 ] ), v ) );
+            _mm_storeu_ps( d2, t );
+            u = v;
+        }
+        _mm_storeu_ps( &y[ i ], u );
+    }
+
+    return i;
+}
+/*============================================================================*/
+__attribute__(( target( "avx2" ) ))
+static size_t qSSmoother_BankSosAVX2( const qSSmoother_SOS_Bank_t * const s,
+                                      const float * const x,
+                                      float * const y )
+{
+    const size_t nc = s->b.nc;
+    size_t i, k;
+
+    for ( i = 0u ; ( i + 8u ) <= nc ; i += 8u ) {
+        __m256 u = _mm256_loadu_ps( &x[ i ] );
+
+        for ( k = 0u ; k < s->ns ; ++k ) {
+            const float * const c = &s->c[ 5u*k ];
+            float * const d1 = &s->d[ ( 2u*k*nc ) + i ];
+            float * const d2 = &s->d[ ( ( ( 2u*k ) + 1u )*nc ) + i ];
+            const __m256 w = _mm256_mul_ps( _mm256_set1_ps( c[ 0 ] ), u );
+            const __m256 v = _mm256_add_ps( w, _mm256_loadu_ps( d1 ) );
+            __m256 t = _mm256_add_ps( _mm256_mul_ps( _mm256_set1_ps( c[ 1 ] ), u ), _mm256_loadu_ps( d2 ) );
+
+            _mm256_storeu_ps( d1, _mm256_sub_ps( t, _mm256_mul_ps( _mm256_set1_ps( c[ 3 ] ), v ) ) );
+            t = _mm256_sub_ps( _mm256_mul_ps( _mm256_set1_ps( c[ 2 ] ), u ),
+                               _mm256_mul_ps( _mm256_set1_ps( c[ 4 ] ), v ) );
+            _mm256_storeu_ps( d2, t );
+            u = v;
+        }
+        _mm256_storeu_ps( &y[ i ], u );
+    }
+
+    return i;
+}
+/*============================================================================*/
+__attribute__(( target( "avx512f" ) ))
+static size_t qSSmoother_BankSosAVX512( const qSSmoother_SOS_Bank_t * const s,
+                                        const float * const x,
+                                        float * const y )
+{
+    const size_t nc = s->b.nc;
+    size_t i, k;
+
+    for ( i = 0u ; ( i + 16u ) <= nc ; i += 16u ) {
+        __m512 u = _mm512_loadu_ps( &x[ i ] );
+
+        for ( k = 0u ; k < s->ns ; ++k ) {
+            const float * const c = &s->c[ 5u*k ];
+            float * const d1 = &s->d[ ( 2u*k*nc ) + i ];
+            float * const d2 = &s->d[ ( ( ( 2u*k ) + 1u )*nc ) + i ];
+            const __m512 w = _mm512_mul_ps( _mm512_set1_ps( c[ 0 ] ), u );
+            const __m512 v = _mm512_add_ps( w, _mm512_loadu_ps( d1 ) );
+            __m512 t = _mm512_add_ps( _mm512_mul_ps( _mm512_set1_ps( c[ 1 ] ), u ), _mm512_loadu_ps( d2 ) );
+
+            _mm512_storeu_ps( d1, _mm512_sub_ps( t, _mm512_mul_ps( _mm512_set1_ps( c[ 3 ] ), v ) ) );
+            t = _mm512_sub_ps( _mm512_mul_ps( _mm512_set1_ps( c[ 2 ] ), u ),
+                               _mm512_mul_ps( _mm512_set1_ps( c[ 4 ] ), v ) );
+            _mm512_storeu_ps( d2, t );
+            u = v;
+        }
+        _mm512_storeu_ps( &y[ i ], u );
+    }
+
+    return i;
+}
+/*============================================================================*/
+__attribute__(( target( "sse2" ) ))
+static void qSSmoother_SosGroupSSE2( const float * const c,
+                                     float * const d,
+                                     const float * const x,
+                                     float * const y,
+                                     const size_t n )
+{
+    /*the four sections run on the lanes of a vector. On each step the lane k
+    takes the output of the lane k-1 from the previous step, so at the step i
+    the section k processes the sample i-k and the output is delayed three
+    steps*/
+    const __m128 b0 = _mm_setr_ps( c[ 0 ], c[ 5 ], c[ 10 ], c[ 15 ] );
+    const __m128 b1 = _mm_setr_ps( c[ 1 ], c[ 6 ], c[ 11 ], c[ 16 ] );
+    const __m128 b2 = _mm_setr_ps( c[ 2 ], c[ 7 ], c[ 12 ], c[ 17 ] );
+    const __m128 a1 = _mm_setr_ps( c[ 3 ], c[ 8 ], c[ 13 ], c[ 18 ] );
+    const __m128 a2 = _mm_setr_ps( c[ 4 ], c[ 9 ], c[ 14 ], c[ 19 ] );
+    const __m128i lane = _mm_setr_epi32( 0, 1, 2, 3 );
+    __m128 d1 = _mm_setr_ps( d[ 0 ], d[ 2 ], d[ 4 ], d[ 6 ] );
+    __m128 d2 = _mm_setr_ps( d[ 1 ], d[ 3 ], d[ 5 ], d[ 7 ] );
+    __m128 v = _mm_setzero_ps();
+    float t[ 4 ];
+    size_t i;
+
+    for ( i = 0u ; i < ( n + 3u ) ; ++i ) {
+        const float xi = ( i < n )? x[ i ] : 0.0f;
+        __m128 u = _mm_castsi128_ps( _mm_slli_si128( _mm_castps_si128( v ), 4 ) );
+        __m128 e1, e2;
+
+        u = _mm_move_ss( u, _mm_set_ss( xi ) );
+        v = _mm_add_ps( _mm_mul_ps( b0, u ), d1 );
+        e1 = _mm_sub_ps( _mm_add_ps( _mm_mul_ps( b1, u ), d2 ), _mm_mul_ps( a1, v ) );
+        e2 = _mm_sub_ps( _mm_mul_ps( b2, u ), _mm_mul_ps( a2, v ) );
+        if ( ( i < 3u ) || ( i >= n ) ) {
+            /*while the pipeline fills and drains, only the lanes k with
+            lo < k < hi hold a sample, the others keep their delays*/
+            const int lo = ( i >= n )? (int)( i - n ) : -1;
+            const int hi = ( i < 3u )? (int)( i + 1u ) : 4;
+            const __m128i in = _mm_and_si128( _mm_cmpgt_epi32( lane, _mm_set1_epi32( lo ) ),
+                                              _mm_cmplt_epi32( lane, _mm_set1_epi32( hi ) ) );
+            const __m128 m = _mm_castsi128_ps( in );
+
+            e1 = _mm_or_ps( _mm_and_ps( m, e1 ), _mm_andnot_ps( m, d1 ) );
+            e2 = _mm_or_ps( _mm_and_ps( m, e2 ), _mm_andnot_ps( m, d2 ) );
+        }
+        d1 = e1;
+        d2 = e2;
+        if ( i >= 3u ) {
+            y[ i - 3u ] = _mm_cvtss_f32( _mm_shuffle_ps( v, v, _MM_SHUFFLE( 3, 3, 3, 3 ) ) );
+        }
+    }
+    _mm_storeu_ps( t, d1 );
+    d[ 0 ] = t[ 0 ];
+    d[ 2 ] = t[ 1 ];
+    d[ 4 ] = t[ 2 ];
+    d[ 6 ] = t[ 3 ];
+    _mm_storeu_ps( t, d2 );
+    d[ 1 ] = t[ 0 ];
+    d[ 3 ] = t[ 1 ];
+    d[ 5 ] = t[ 2 ];
+    d[ 7 ] = t[ 3 ];
+}
+/*============================================================================*/
+#endif
+#if defined( QSIMD_ARM )
+static size_t qSSmoother_BankLerpNEON( float * const s,
+                                       const float * const p,
+                                       const float * const q,
+                                       float * const y,
+                                       const size_t nc,
+                                       const float c )
+{
+    const float32x4_t vc = vdupq_n_f32( c );
+    size_t i;
+
+    for ( i = 0u ; ( i + 4u ) <= nc ; i += 4u ) {
+        const float32x4_t vp = vld1q_f32( &p[ i ] );
+        const float32x4_t d = vsubq_f32( vld1q_f32( &q[ i ] ), vp );
+        const float32x4_t v = vaddq_f32( vp, vmulq_f32( vc, d ) );
+
+        vst1q_f32( &s[ i ], v );
+        vst1q_f32( &y[ i ], v );
+    }
+
+    return i;
+}
+/*============================================================================*/
+static size_t qSSmoother_BankMixNEON( float * const s,
+                                      const float * const x,
+                                      float * const y,
+                                      const size_t nc,
+                                      const float a,
+                                      const float c )
+{
+    const float32x4_t va = vdupq_n_f32( a );
+    const float32x4_t vc = vdupq_n_f32( c );
+    size_t i;
+
+    for ( i = 0u ; ( i + 4u ) <= nc ; i += 4u ) {
+        const float32x4_t vs = vmulq_f32( vld1q_f32( &s[ i ] ), va );
+        const float32x4_t v = vaddq_f32( vs, vmulq_f32( vc, vld1q_f32( &x[ i ] ) ) );
+
+        vst1q_f32( &s[ i ], v );
+        vst1q_f32( &y[ i ], v );
+    }
+
+    return i;
+}
+/*============================================================================*/
+static size_t qSSmoother_BankBiquadNEON( const qSSmoother_LPF2_Bank_t * const s,
+                                         const float * const x,
+                                         float * const y )
+{
+    const float32x4_t k = vdupq_n_f32( s->k );
+    const float32x4_t a1 = vdupq_n_f32( s->a1 );
+    const float32x4_t a2 = vdupq_n_f32( s->a2 );
+    const float32x4_t b1 = vdupq_n_f32( s->b1 );
+    const size_t nc = s->b.nc;
+    size_t i;
+
+    for ( i = 0u ; ( i + 4u ) <= nc ; i += 4u ) {
+        const float32x4_t xi = vld1q_f32( &x[ i ] );
+        float32x4_t yi = vmulq_f32( k, xi );
+
+        yi = vaddq_f32( yi, vmulq_f32( b1, vld1q_f32( &s->x1[ i ] ) ) );
+        yi = vaddq_f32( yi, vmulq_f32( k, vld1q_f32( &s->x2[ i ] ) ) );
+        yi = vsubq_f32( yi, vmulq_f32( a1, vld1q_f32( &s->y1[ i ] ) ) );
+        yi = vsubq_f32( yi, vmulq_f32( a2, vld1q_f32( &s->y2[ i ] ) ) );
+        vst1q_f32( &s->x2[ i ], xi );
+        vst1q_f32( &s->y2[ i ], yi );
+        vst1q_f32( &y[ i ], yi );
+    }
+
+    return i;
+}
+/*============================================================================*/
+static size_t qSSmoother_BankSosNEON( const qSSmoother_SOS_Bank_t * const s,
+                                      const float * const x,
+                                      float * const y )
+{
+    const size_t nc = s->b.nc;
+    size_t i, k;
+
+    for ( i = 0u ; ( i + 4u ) <= nc ; i += 4u ) {
+        float32x4_t u = vld1q_f32( &x[ i ] );
+
+        for ( k = 0u ; k < s->ns ; ++k ) {
+            const float * const c = &s->c[ 5u*k ];
+            float * const d1 = &s->d[ ( 2u*k*nc ) + i ];
+            float * const d2 = &s->d[ ( ( ( 2u*k ) + 1u )*nc ) + i ];
+            const float32x4_t v = vaddq_f32( vmulq_n_f32( u, c[ 0 ] ), vld1q_f32( d1 ) );
+            float32x4_t t = vaddq_f32( vmulq_n_f32( u, c[ 1 ] ), vld1q_f32( d2 ) );
+
+            vst1q_f32( d1, vsubq_f32( t, vmulq_n_f32( v, c[ 3 ] ) ) );
+            t = vsubq_f32( vmulq_n_f32( u, c[ 2 ] ), vmulq_n_f32( v, c[ 4 ] ) );
+            vst1q_f32( d2, t );
+            u = v;
+        }
+        vst1q_f32( &y[ i ], u );
+    }
+
+    return i;
+}
+/*============================================================================*/
+static void qSSmoother_SosGroupNEON( const float * const c,
+                                     float * const d,
+                                     const float * const x,
+                                     float * const y,
+                                     const size_t n )
+{
+    /*same pipeline as qSSmoother_SosGroupSSE2()*/
+    const float cb0[ 4 ] = { c[ 0 ], c[ 5 ], c[ 10 ], c[ 15 ] };
+    const float cb1[ 4 ] = { c[ 1 ], c[ 6 ], c[ 11 ], c[ 16 ] };
+    const float cb2[ 4 ] = { c[ 2 ], c[ 7 ], c[ 12 ], c[ 17 ] };
+    const float ca1[ 4 ] = { c[ 3 ], c[ 8 ], c[ 13 ], c[ 18 ] };
+    const float ca2[ 4 ] = { c[ 4 ], c[ 9 ], c[ 14 ], c[ 19 ] };
+    const float cd1[ 4 ] = { d[ 0 ], d[ 2 ], d[ 4 ], d[ 6 ] };
+    const float cd2[ 4 ] = { d[ 1 ], d[ 3 ], d[ 5 ], d[ 7 ] };
+    const uint32_t cl[ 4 ] = { 0u, 1u, 2u, 3u };
+    const float32x4_t b0 = vld1q_f32( cb0 );
+    const float32x4_t b1 = vld1q_f32( cb1 );
+    const float32x4_t b2 = vld1q_f32( cb2 );
+    const float32x4_t a1 = vld1q_f32( ca1 );
+    const float32x4_t a2 = vld1q_f32( ca2 );
+    const uint32x4_t lane = vld1q_u32( cl );
+    float32x4_t d1 = vld1q_f32( cd1 );
+    float32x4_t d2 = vld1q_f32( cd2 );
+    float32x4_t v = vdupq_n_f32( 0.0f );
+    float t[ 4 ];
+    size_t i;
+
+    for ( i = 0u ; i < ( n + 3u ) ; ++i ) {
+        const float xi = ( i < n )? x[ i ] : 0.0f;
+        const float32x4_t u = vextq_f32( vdupq_n_f32( xi ), v, 3 );
+        float32x4_t e1, e2;
+
+        v = vaddq_f32( vmulq_f32( b0, u ), d1 );
+        e1 = vsubq_f32( vaddq_f32( vmulq_f32( b1, u ), d2 ), vmulq_f32( a1, v ) );
+        e2 = vsubq_f32( vmulq_f32( b2, u ), vmulq_f32( a2, v ) );
+        if ( ( i < 3u ) || ( i >= n ) ) {
+            const uint32_t lo = ( i >= n )? (uint32_t)( i - n + 1u ) : 0u;
+            const uint32_t hi = ( i < 3u )? (uint32_t)i : 3u;
+            const uint32x4_t m = vandq_u32( vcgeq_u32( lane, vdupq_n_u32( lo ) ),
+                                            vcleq_u32( lane, vdupq_n_u32( hi ) ) );
+
+            e1 = vbslq_f32( m, e1, d1 );
+            e2 = vbslq_f32( m, e2, d2 );
+        }
+        d1 = e1;
+        d2 = e2;
+        if ( i >= 3u ) {
+            y[ i - 3u ] = vgetq_lane_f32( v, 3 );
+        }
+    }
+    vst1q_f32( t, d1 );
+    d[ 0 ] = t[ 0 ];
+    d[ 2 ] = t[ 1 ];
+    d[ 4 ] = t[ 2 ];
+    d[ 6 ] = t[ 3 ];
+    vst1q_f32( t, d2 );
+    d[ 1 ] = t[ 0 ];
+    d[ 3 ] = t[ 1 ];
+    d[ 5 ] = t[ 2 ];
+    d[ 7 ] = t[ 3 ];
 }
 /*============================================================================*/
+#endif
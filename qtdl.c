@@ -5,9 +5,14 @@
  **/
 
 #include "qtdl.h"
+#include <string.h>
 
 static void qTDL_InsertNewest( qTDL_t * const q, float sample );
 static void qTDL_RemoveOldest( qTDL_t * const q );
+static void qTDL_CopyIn( qTDL_t * const q,
+                         const size_t offset,
+                         const float * const src,
+                         const size_t n );
 
 /*============================================================================*/
 void qTDL_Setup( qTDL_t * const q,
@@ -17,6 +22,18 @@ void qTDL_Setup( qTDL_t * const q,
 {
     q->itemcount = n;
     q->head = area;
+    q->mirror = 0u;
+    qTDL_Flush( q, initval );
+}
+/*============================================================================*/
+void qTDL_SetupMirrored( qTDL_t * const q,
+                         float * const area,
+                         const size_t n,
+                         const float initval )
+{
+    q->itemcount = n;
+    q->head = area;
+    q->mirror = 1u;
     qTDL_Flush( q, initval );
 }
 /*============================================================================*/
@@ -39,6 +56,9 @@ static void qTDL_InsertNewest( qTDL_t * const q,
                                const float sample )
 {
     q->wr[ 0 ] = sample;
+    if ( 0u != q->mirror ) {
+        q->wr[ q->itemcount ] = sample; /*keep the upper copy in sync*/
+    }
     q->wr++;
     if ( q->wr >= q->tail ) {
         q->wr = q->head;
@@ -76,4 +96,196 @@ void qTDL_InsertSample( qTDL_t * const q,
     qTDL_RemoveOldest( q );
     qTDL_InsertNewest( q, sample );
 }
-/*============================================================================*/
\ No newline at end of file
+/*============================================================================*/
+static void qTDL_CopyIn( qTDL_t * const q,
+                         const size_t offset,
+                         const float * const src,
+                         const size_t n )
+{
+    memcpy( &q->head[ offset ], src, n*sizeof(float) );
+    if ( 0u != q->mirror ) {
+        memcpy( &q->head[ offset + q->itemcount ], src, n*sizeof(float) );
+    }
+}
+/*============================================================================*/
+void qTDL_InsertBlock( qTDL_t * const q,
+                       const float * const src,
+                       const size_t n )
+{
+    if ( ( NULL != src ) && ( n > 0u ) ) {
+        /*only the last itemcount samples of the block survive*/
+        const size_t m = ( n > q->itemcount )? q->itemcount : n;
+        const float * const s = &src[ n - m ];
+        /*cstat -MISRAC2012-Rule-18.4 -CERT-ARR36-C*/
+        const size_t w = (size_t)( q->wr - q->head );
+        /*cstat +MISRAC2012-Rule-18.4 +CERT-ARR36-C*/
+        const size_t first = ( m < ( q->itemcount - w ) )? m : ( q->itemcount - w );
+
+        qTDL_CopyIn( q, w, s, first );
+        if ( m > first ) {
+            qTDL_CopyIn( q, 0u, &s[ first ], m - first );
+        }
+        q->wr = &q->head[ ( w + m ) % q->itemcount ];
+        /*the most recent sample is the one before the write slot*/
+        q->rd = ( q->wr == q->head )? ( q->tail - 1 ) : ( q->wr - 1 );
+    }
+}
+/*============================================================================*/
+int qTDL_ReadBlock( const qTDL_t * const q,
+                    const size_t start,
+                    float * const dst,
+                    const size_t n )
+{
+    int retValue = 0;
+
+    if ( ( NULL != dst ) && ( start <= q->itemcount ) &&
+         ( n <= ( q->itemcount - start ) ) ) {
+        /*cstat -MISRAC2012-Rule-18.4 -CERT-ARR36-C*/
+        const size_t w = (size_t)( q->wr - q->head );
+        /*cstat +MISRAC2012-Rule-18.4 +CERT-ARR36-C*/
+        /*the oldest sample is at the write slot*/
+        const size_t r = ( w + start ) % q->itemcount;
+        const size_t first = ( n < ( q->itemcount - r ) )? n : ( q->itemcount - r );
+
+        if ( n > 0u ) {
+            memcpy( dst, &q->head[ r ], first*sizeof(float) );
+            if ( n > first ) {
+                memcpy( &dst[ first ], q->head, ( n - first )*sizeof(float) );
+            }
+        }
+        retValue = 1;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+const float* qTDL_GetWindow( const qTDL_t * const q )
+{
+    /*the oldest sample is at the write slot and the following n-1 samples
+    are contiguous thanks to the upper copy*/
+    return ( 0u != q->mirror )? q->wr : NULL;
+}
+/*============================================================================*/
+void qTDL_Pow2_Setup( qTDL_Pow2_t * const q,
+                      float * const area,
+                      const size_t n,
+                      const float initval )
+{
+    size_t size = 1u;
+
+    while ( size < n ) {
+        size <<= 1u;
+    }
+    q->head = area;
+    q->mask = size - 1u;
+    q->itemcount = n;
+    qTDL_Pow2_Flush( q, initval );
+}
+/*============================================================================*/
+void qTDL_Pow2_Flush( qTDL_Pow2_t * const q,
+                      const float initval )
+{
+    size_t i;
+
+    for ( i = 0u ; i <= q->mask ; ++i ) {
+        q->head[ i ] = initval;
+    }
+    q->wr = 0u;
+}
+/*============================================================================*/
+float qTDL_Pow2_GetOldest( const qTDL_Pow2_t * const q )
+{
+    /*cstat -CERT-INT30-C_a*/
+    return q->head[ ( q->wr - q->itemcount ) & q->mask ];
+    /*cstat +CERT-INT30-C_a*/
+}
+/*============================================================================*/
+float qTDL_Pow2_GetAtIndex( const qTDL_Pow2_t * const q,
+                            const size_t i )
+{
+    /*cstat -CERT-INT30-C_a*/
+    return q->head[ ( q->wr - 1u - i ) & q->mask ];
+    /*cstat +CERT-INT30-C_a*/
+}
+/*============================================================================*/
+float qTDL_Pow2_GetRecent( const qTDL_Pow2_t * const q )
+{
+    /*cstat -CERT-INT30-C_a*/
+    return q->head[ ( q->wr - 1u ) & q->mask ];
+    /*cstat +CERT-INT30-C_a*/
+}
+/*============================================================================*/
+void qTDL_Pow2_InsertSample( qTDL_Pow2_t * const q,
+                             const float sample )
+{
+    /*the counter is free-running, the wrap-around is handled by the mask*/
+    q->head[ q->wr & q->mask ] = sample;
+    ++q->wr;
+}
+/*============================================================================*/
+void qTDL_Bank_Setup( qTDL_Bank_t * const b,
+                      float * const area,
+                      const size_t m,
+                      const size_t n,
+                      const float initval )
+{
+    b->head = area;
+    b->nChannels = m;
+    b->itemcount = n;
+    qTDL_Bank_Flush( b, initval );
+}
+/*============================================================================*/
+void qTDL_Bank_Flush( qTDL_Bank_t * const b,
+                      const float initval )
+{
+    size_t i;
+    const size_t total = b->nChannels*b->itemcount;
+
+    for ( i = 0u ; i < total ; ++i ) {
+        b->head[ i ] = initval;
+    }
+    b->wr = 0u;
+}
+/*============================================================================*/
+void qTDL_Bank_InsertFrame( qTDL_Bank_t * const b,
+                            const float * const frame )
+{
+    /*overwrite the oldest frame*/
+    memcpy( &b->head[ b->wr*b->nChannels ], frame, b->nChannels*sizeof(float) );
+    if ( ++b->wr >= b->itemcount ) {
+        b->wr = 0u;
+    }
+}
+/*============================================================================*/
+void qTDL_Bank_GetOldestFrame( const qTDL_Bank_t * const b,
+                               float * const frame )
+{
+    memcpy( frame, &b->head[ b->wr*b->nChannels ], b->nChannels*sizeof(float) );
+}
+/*============================================================================*/
+const float* qTDL_Bank_GetFrame( const qTDL_Bank_t * const b,
+                                 const size_t i )
+{
+    /*the most recent frame is right before the write slot*/
+    const size_t k = ( i < b->wr )? ( b->wr - 1u - i )
+                                  : ( ( b->itemcount + b->wr ) - 1u - i );
+
+    return &b->head[ k*b->nChannels ];
+}
+/*============================================================================*/
+float qTDL_Bank_GetAtIndex( const qTDL_Bank_t * const b,
+                            const size_t channel,
+                            const size_t i )
+{
+    return qTDL_Bank_GetFrame( b, i )[ channel ];
+}
+/*============================================================================*/
+/*cstat -MISRAC2012-Dir-4.9 -MISRAC2012-Rule-20.7*/
+QTDL_DEFINE( qTDL_i16, int16_t )
+QTDL_DEFINE( qTDL_i32, int32_t )
+QTDL_DEFINE( qTDL_f64, double )
+#if !defined( __STDC_NO_COMPLEX__ )
+    QTDL_DEFINE( qTDL_cf32, float _Complex )
+#endif
+/*cstat +MISRAC2012-Dir-4.9 +MISRAC2012-Rule-20.7*/
+/*============================================================================*/
@@ -0,0 +1,155 @@
+/*!
+ * @file qtdlspsc.c
+ * @author J. Camilo Gomez C.
+ * @note This file is part of the qTools distribution.
+ **/
+
+#include "qtdlspsc.h"
+#include <string.h>
+
+/*The producer follows the sequence lock protocol with two counters: claim is
+advanced before the slots are written and count after they are published.
+A reader that copies the slots between the two reads of the counters knows
+which writes could have touched them. The slots are atomic, so a copy that
+races with the producer is only stale, never undefined, and a slot written
+after the claim lets the fences of both sides synchronize*/
+
+_Static_assert( sizeof(float) == sizeof(uint32_t), "qtdlspsc requires 32-bit floats" );
+
+static void qTDL_SPSC_Store( qTDL_SPSC_Slot_t * const dst,
+                             const float * const src,
+                             const size_t n );
+static void qTDL_SPSC_Load( float * const dst,
+                            qTDL_SPSC_Slot_t * const src,
+                            const size_t n );
+static void qTDL_SPSC_Write( qTDL_SPSC_t * const q,
+                             const size_t c,
+                             const float * const src,
+                             const size_t n );
+
+/*============================================================================*/
+int qTDL_SPSC_Setup( qTDL_SPSC_t * const q,
+                     qTDL_SPSC_Slot_t * const area,
+                     const size_t n,
+                     const float initval )
+{
+    int retValue = 0;
+
+    if ( ( NULL != q ) && ( NULL != area ) && ( n > 0u ) &&
+         ( 0u == ( n & ( n - 1u ) ) ) ) {
+        uint32_t bits;
+        size_t i;
+
+        q->head = area;
+        q->size = n;
+        q->mask = n - 1u;
+        (void)memcpy( &bits, &initval, sizeof(bits) );
+        for ( i = 0u ; i < n ; ++i ) {
+            atomic_init( &area[ i ], bits );
+        }
+        /*start one lap ahead, so every slot holds a valid sample*/
+        atomic_init( &q->claim, n );
+        atomic_init( &q->count, n );
+        retValue = 1;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static void qTDL_SPSC_Store( qTDL_SPSC_Slot_t * const dst,
+                             const float * const src,
+                             const size_t n )
+{
+    size_t i;
+
+    for ( i = 0u ; i < n ; ++i ) {
+        uint32_t bits;
+
+        (void)memcpy( &bits, &src[ i ], sizeof(bits) );
+        atomic_store_explicit( &dst[ i ], bits, memory_order_relaxed );
+    }
+}
+/*============================================================================*/
+static void qTDL_SPSC_Load( float * const dst,
+                            qTDL_SPSC_Slot_t * const src,
+                            const size_t n )
+{
+    size_t i;
+
+    for ( i = 0u ; i < n ; ++i ) {
+        const uint32_t bits = atomic_load_explicit( &src[ i ], memory_order_relaxed );
+
+        (void)memcpy( &dst[ i ], &bits, sizeof(bits) );
+    }
+}
+/*============================================================================*/
+static void qTDL_SPSC_Write( qTDL_SPSC_t * const q,
+                             const size_t c,
+                             const float * const src,
+                             const size_t n )
+{
+    const size_t w = c & q->mask;
+    const size_t first = ( n < ( q->size - w ) )? n : ( q->size - w );
+
+    /*claim the slots and order the claim before the slot stores*/
+    atomic_store_explicit( &q->claim, c + n, memory_order_relaxed );
+    atomic_thread_fence( memory_order_release );
+    qTDL_SPSC_Store( &q->head[ w ], src, first );
+    if ( n > first ) {
+        qTDL_SPSC_Store( q->head, &src[ first ], n - first );
+    }
+    /*publish the new samples*/
+    atomic_store_explicit( &q->count, c + n, memory_order_release );
+}
+/*============================================================================*/
+void qTDL_SPSC_InsertSample( qTDL_SPSC_t * const q,
+                             const float sample )
+{
+    /*the producer is the only writer of the counters*/
+    const size_t c = atomic_load_explicit( &q->count, memory_order_relaxed );
+
+    qTDL_SPSC_Write( q, c, &sample, 1u );
+}
+/*============================================================================*/
+void qTDL_SPSC_InsertBlock( qTDL_SPSC_t * const q,
+                            const float * const src,
+                            const size_t n )
+{
+    if ( ( NULL != src ) && ( n > 0u ) ) {
+        const size_t c = atomic_load_explicit( &q->count, memory_order_relaxed );
+        /*only the last size samples of the block survive*/
+        const size_t m = ( n > q->size )? q->size : n;
+
+        qTDL_SPSC_Write( q, c + ( n - m ), &src[ n - m ], m );
+    }
+}
+/*============================================================================*/
+int qTDL_SPSC_Snapshot( qTDL_SPSC_t * const q,
+                        float * const dst,
+                        const size_t n )
+{
+    int retValue = 0;
+
+    if ( ( NULL != dst ) && ( n <= q->size ) ) {
+        const size_t c = atomic_load_explicit( &q->count, memory_order_acquire );
+        const size_t start = c - n;
+        const size_t r = start & q->mask;
+        const size_t first = ( n < ( q->size - r ) )? n : ( q->size - r );
+        size_t claimed;
+
+        qTDL_SPSC_Load( dst, &q->head[ r ], first );
+        if ( n > first ) {
+            qTDL_SPSC_Load( &dst[ first ], q->head, n - first );
+        }
+        /*order the copy before reading how far the producer has gone: if any
+        copied slot was written after a claim, this fence synchronizes with
+        the one of the producer and the claim is seen. The oldest copied
+        sample is overwritten by the write number start + size*/
+        atomic_thread_fence( memory_order_acquire );
+        claimed = atomic_load_explicit( &q->claim, memory_order_relaxed );
+        retValue = ( ( claimed - start ) <= q->size )? 1 : 0;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
@@ -0,0 +1,195 @@
+/*!
+ * @file qcrcsum.c
+ * @author J. Camilo Gomez C.
+ * @note This file is part of the qTools distribution.
+ * @brief Command-line tool to checksum files with any CRC parameter set.
+ * The 8, 16 and 32 bits widths use the multi-threaded driver on top of
+ * memory-mapped files, the other widths from 3 to 64 bits are read
+ * sequentially by the generic-width engine.
+ *
+ * Build ( POSIX ):
+ *   cc -std=c99 -O2 -Iinclude tools/qcrcsum.c qcrc.c qcrcpar.c -lpthread -o qcrcsum
+ *
+ * Usage:
+ *   qcrcsum [-t threads] [width poly init refin refout xorout] file...
+ *     -t  Threads for the 8, 16 and 32 bits widths ( default: online cpus ).
+ *   The default parameter set is CRC-32/ISO-HDLC. A file whose name starts
+ *   with a digit can be given after the parameters, or as ./name.
+ **/
+
+#ifndef _POSIX_C_SOURCE
+    #define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "qcrc.h"
+#include "qcrcpar.h"
+
+#define QCRCSUM_NPARAMS     ( 6 )
+#define QCRCSUM_BUFFER_SIZE ( 65536u )
+
+typedef struct {
+    uint8_t width;
+    uint64_t poly, init;
+    uint8_t refIn, refOut;
+    uint64_t xorOut;
+} qCRCSum_Param_t;
+
+static int qCRCSum_ParseNumber( const char * const s,
+                                uint64_t * const value );
+static int qCRCSum_ParseParam( char * const argv[],
+                               qCRCSum_Param_t * const p );
+static int qCRCSum_FileN( const qCRCn_Engine_t * const e,
+                          const char * const path,
+                          uint64_t * const crc );
+static void qCRCSum_Usage( const char * const name );
+
+/*============================================================================*/
+static int qCRCSum_ParseNumber( const char * const s,
+                                uint64_t * const value )
+{
+    char *end = NULL;
+    int retValue = 0;
+
+    if ( ( s[ 0 ] >= '0' ) && ( s[ 0 ] <= '9' ) ) {
+        *value = (uint64_t)strtoull( s, &end, 0 );
+        retValue = ( ( NULL != end ) && ( '\0' == *end ) )? 1 : 0;
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static int qCRCSum_ParseParam( char * const argv[],
+                               qCRCSum_Param_t * const p )
+{
+    uint64_t v[ QCRCSUM_NPARAMS ];
+    int i, retValue = 1;
+
+    for ( i = 0 ; i < QCRCSUM_NPARAMS ; ++i ) {
+        if ( 0 == qCRCSum_ParseNumber( argv[ i ], &v[ i ] ) ) {
+            (void)fprintf( stderr, "qcrcsum: invalid parameter %s\n", argv[ i ] );
+            retValue = 0;
+            break;
+        }
+    }
+    if ( 1 == retValue ) {
+        if ( ( v[ 0 ] < 3u ) || ( v[ 0 ] > 64u ) || ( v[ 3 ] > 1u ) || ( v[ 4 ] > 1u ) ) {
+            (void)fprintf( stderr, "qcrcsum: width must be 3 to 64, refin and refout 0 or 1\n" );
+            retValue = 0;
+        }
+        else {
+            p->width = (uint8_t)v[ 0 ];
+            p->poly = v[ 1 ];
+            p->init = v[ 2 ];
+            p->refIn = (uint8_t)v[ 3 ];
+            p->refOut = (uint8_t)v[ 4 ];
+            p->xorOut = v[ 5 ];
+        }
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static int qCRCSum_FileN( const qCRCn_Engine_t * const e,
+                          const char * const path,
+                          uint64_t * const crc )
+{
+    static uint8_t buffer[ QCRCSUM_BUFFER_SIZE ];
+    int retValue = 0;
+    FILE *f = fopen( path, "rb" );
+
+    if ( NULL != f ) {
+        qCRCn_State_t s;
+        size_t n;
+
+        (void)qCRCn_Init( &s, e );
+        while ( ( n = fread( buffer, 1u, sizeof(buffer), f ) ) > 0u ) {
+            (void)qCRCn_Update( &s, buffer, n );
+        }
+        retValue = ( 0 == ferror( f ) )? 1 : 0;
+        *crc = qCRCn_Final( &s );
+        (void)fclose( f );
+    }
+
+    return retValue;
+}
+/*============================================================================*/
+static void qCRCSum_Usage( const char * const name )
+{
+    (void)fprintf( stderr, "usage: %s [-t threads] [width poly init refin refout xorout] file...\n", name );
+}
+/*============================================================================*/
+int main( int argc, char *argv[] )
+{
+    /*CRC-32/ISO-HDLC*/
+    qCRCSum_Param_t p = { 32u, 0x04C11DB7u, 0xFFFFFFFFu, 1u, 1u, 0xFFFFFFFFu };
+    qCRC_Engine_t engine;
+    qCRCn_Engine_t engineN;
+    size_t nThreads = 0u;
+    uint64_t value;
+    int i = 1, ret = EXIT_SUCCESS;
+    int fast, digits;
+
+    if ( ( argc > 2 ) && ( 0 == strcmp( argv[ 1 ], "-t" ) ) ) {
+        if ( 0 == qCRCSum_ParseNumber( argv[ 2 ], &value ) ) {
+            qCRCSum_Usage( argv[ 0 ] );
+            return 2;
+        }
+        nThreads = (size_t)value;
+        i = 3;
+    }
+    /*the parameters are only taken if the first one is a number*/
+    if ( ( i < argc ) && ( 1 == qCRCSum_ParseNumber( argv[ i ], &value ) ) ) {
+        if ( ( argc - i ) < QCRCSUM_NPARAMS ) {
+            qCRCSum_Usage( argv[ 0 ] );
+            return 2;
+        }
+        if ( 0 == qCRCSum_ParseParam( &argv[ i ], &p ) ) {
+            return 2;
+        }
+        i += QCRCSUM_NPARAMS;
+    }
+    if ( i >= argc ) {
+        qCRCSum_Usage( argv[ 0 ] );
+        return 2;
+    }
+
+    fast = ( ( 8u == p.width ) || ( 16u == p.width ) || ( 32u == p.width ) )? 1 : 0;
+    if ( 1 == fast ) {
+        const qCRC_Mode_t mode = ( 8u == p.width )? QCRC8 :
+                                 ( ( 16u == p.width )? QCRC16 : QCRC32 );
+
+        (void)qCRCx_Setup( &engine, mode, (uint32_t)p.poly, (uint32_t)p.init,
+                           p.refIn, p.refOut, (uint32_t)p.xorOut );
+    }
+    else {
+        (void)qCRCn_Setup( &engineN, p.width, p.poly, p.init,
+                           p.refIn, p.refOut, p.xorOut );
+    }
+    digits = ( (int)p.width + 3 )/4;
+    for ( ; i < argc ; ++i ) {
+        int ok;
+
+        if ( 1 == fast ) {
+            uint32_t crc = 0u;
+
+            ok = qCRCx_File( &engine, argv[ i ], nThreads, &crc );
+            value = crc;
+        }
+        else {
+            ok = qCRCSum_FileN( &engineN, argv[ i ], &value );
+        }
+        if ( 1 == ok ) {
+            (void)printf( "%0*llX  %s\n", digits, (unsigned long long)value, argv[ i ] );
+        }
+        else {
+            (void)fprintf( stderr, "qcrcsum: cannot read %s\n", argv[ i ] );
+            ret = EXIT_FAILURE;
+        }
+    }
+
+    return ret;
+}